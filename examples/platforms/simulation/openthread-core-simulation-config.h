@@ -51,6 +51,10 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE 1
 #endif
 
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE 1
+#endif
+
 #if OPENTHREAD_RADIO
 
 #ifndef OPENTHREAD_CONFIG_MAC_SOFTWARE_ACK_TIMEOUT_ENABLE
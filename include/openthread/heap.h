@@ -36,6 +36,9 @@
 #define OPENTHREAD_HEAP_H_
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +67,57 @@ void *otHeapCAlloc(size_t aCount, size_t aSize);
  */
 void otHeapFree(void *aPointer);
 
+#define OT_HEAP_NUM_SIZE_CLASSES 9 ///< Number of size classes of the segregated-fit heap (including large blocks).
+
+/**
+ * Represents information about a size class of the segregated-fit heap.
+ */
+typedef struct otHeapSizeClassInfo
+{
+    uint32_t mBlockSize;       ///< Block size in bytes (zero for the large allocations class).
+    uint32_t mNumPages;        ///< Number of heap pages currently used by the class.
+    uint32_t mNumAllocated;    ///< Number of blocks currently allocated.
+    uint32_t mMaxAllocated;    ///< Maximum number of blocks allocated at the same time.
+    uint32_t mNumAllocs;       ///< Total number of successful allocations.
+    uint32_t mNumFailedAllocs; ///< Total number of failed allocations.
+} otHeapSizeClassInfo;
+
+/**
+ * Gets the capacity (in bytes) of the OpenThread internal heap.
+ *
+ * Requires `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE`.
+ *
+ * @returns The heap capacity in bytes.
+ */
+size_t otHeapGetCapacity(void);
+
+/**
+ * Gets the free space (in bytes) of the OpenThread internal heap.
+ *
+ * Requires `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE`.
+ *
+ * The free space includes the unused blocks in the heap pages assigned to small size classes.
+ *
+ * @returns The heap free space in bytes.
+ */
+size_t otHeapGetFreeSize(void);
+
+/**
+ * Gets the information about a size class of the OpenThread internal heap.
+ *
+ * Requires `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE`.
+ *
+ * The size classes are ordered by block size. The last one (index `OT_HEAP_NUM_SIZE_CLASSES - 1`) represents the
+ * large allocations, which use whole heap pages.
+ *
+ * @param[in]  aIndex  The size class index.
+ * @param[out] aInfo   A pointer to return the size class information.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the information.
+ * @retval OT_ERROR_NOT_FOUND  @p aIndex is not a valid size class index.
+ */
+otError otHeapGetSizeClassInfo(uint8_t aIndex, otHeapSizeClassInfo *aInfo);
+
 /**
  * @}
  */
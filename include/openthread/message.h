@@ -443,6 +443,19 @@ typedef struct otBufferInfo
      */
     uint16_t mMaxUsedBuffers;
 
+    /**
+     * The total number of large buffers in the messages pool (zero if large buffers are not supported, or 0xffff if
+     * unknown).
+     */
+    uint16_t mTotalLargeBuffers;
+    uint16_t mFreeLargeBuffers; ///< The number of free large buffers (0xffff if unknown).
+
+    /**
+     * The maximum number of used large buffers at the same time since OT stack initialization or last call to
+     * `otMessageResetBufferInfo()`.
+     */
+    uint16_t mMaxUsedLargeBuffers;
+
     otMessageQueueInfo m6loSendQueue;         ///< Info about 6LoWPAN send queue.
     otMessageQueueInfo m6loReassemblyQueue;   ///< Info about 6LoWPAN reassembly queue.
     otMessageQueueInfo mIp6Queue;             ///< Info about IPv6 send queue.
@@ -134,6 +134,20 @@ typedef struct otNat64ErrorCounters
     uint64_t mCount6To4[OT_NAT64_DROP_REASON_COUNT]; ///< Errors translating IPv6 packets.
 } otNat64ErrorCounters;
 
+/**
+ * Represents the counters of the NAT64 address mapping table lookups.
+ *
+ * The mapping table is indexed by hash tables. The number of probed entries per lookup indicates how well the
+ * mappings are distributed in the hash tables.
+ */
+typedef struct otNat64MappingLookupCounters
+{
+    uint64_t mLookups;   ///< Number of mapping lookups (translated packets and mapping allocations).
+    uint64_t mMisses;    ///< Number of lookups which did not find a matching mapping.
+    uint64_t mProbes;    ///< Total number of entries probed by all lookups.
+    uint32_t mMaxProbes; ///< Maximum number of entries probed by a single lookup.
+} otNat64MappingLookupCounters;
+
 /**
  * Gets NAT64 translator counters.
  *
@@ -156,6 +170,18 @@ void otNat64GetCounters(otInstance *aInstance, otNat64ProtocolCounters *aCounter
  */
 void otNat64GetErrorCounters(otInstance *aInstance, otNat64ErrorCounters *aCounters);
 
+/**
+ * Gets the NAT64 translator address mapping table lookup counters.
+ *
+ * The counters are initialized to zero when the OpenThread instance is initialized.
+ *
+ * Available when `OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ * @param[out] aCounters A pointer to an `otNat64MappingLookupCounters` where the counters will be placed.
+ */
+void otNat64GetMappingLookupCounters(otInstance *aInstance, otNat64MappingLookupCounters *aCounters);
+
 /**
  * Represents an address mapping record for NAT64.
  *
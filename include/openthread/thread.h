@@ -201,6 +201,17 @@ typedef struct otMleCounters
     uint16_t mParentChanges;
 } otMleCounters;
 
+/**
+ * Represents the `KeyManager` derived key cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE`.
+ */
+typedef struct otKeyCacheCounters
+{
+    uint32_t mHits;   ///< Number of non-current key sequence lookups served from the cache.
+    uint32_t mMisses; ///< Number of non-current key sequence lookups which required deriving the key.
+} otKeyCacheCounters;
+
 /**
  * Represents the MLE Parent Response data.
  */
@@ -907,6 +918,26 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance);
  */
 void otThreadResetMleCounters(otInstance *aInstance);
 
+/**
+ * Gets the `KeyManager` derived key cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the key cache counters.
+ */
+const otKeyCacheCounters *otThreadGetKeyCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the `KeyManager` derived key cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otThreadResetKeyCacheCounters(otInstance *aInstance);
+
 /**
  * Gets the current attach duration (number of seconds since the device last attached).
  *
@@ -125,6 +125,15 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the EID cache lookup counters.
+ */
+typedef struct otAddressCacheCounters
+{
+    uint32_t mHits;   ///< Number of EID lookups resolved from a cached or snooped entry.
+    uint32_t mMisses; ///< Number of EID lookups that did not find a usable cached or snooped entry.
+} otAddressCacheCounters;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -635,6 +644,22 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * Gets the EID cache lookup counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache lookup counters.
+ */
+const otAddressCacheCounters *otThreadGetAddressCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the EID cache lookup counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otThreadResetAddressCacheCounters(otInstance *aInstance);
+
 /**
  * Clears the EID cache.
  *
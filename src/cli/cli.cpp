@@ -1130,6 +1130,8 @@ template <> otError Interpreter::Process<Cmd("domainname")>(Arg aArgs[])
  * *   `free` displays the number of free message buffers.
  * *   `max-used` displays max number of used buffers at the same time since OT stack
  *     initialization or last `bufferinfo reset`.
+ * *   `large-total`, `large-free` and `large-max-used` display the same information for
+ *     large message buffers. They are only shown when large buffers are supported.
  * @par
  * Next, the CLI displays info about different queues used by the OpenThread stack,
  * for example `6lo send`. Each line after the queue represents info about a queue:
@@ -1169,6 +1171,13 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         OutputLine("free: %u", bufferInfo.mFreeBuffers);
         OutputLine("max-used: %u", bufferInfo.mMaxUsedBuffers);
 
+        if (bufferInfo.mTotalLargeBuffers != 0)
+        {
+            OutputLine("large-total: %u", bufferInfo.mTotalLargeBuffers);
+            OutputLine("large-free: %u", bufferInfo.mFreeLargeBuffers);
+            OutputLine("large-max-used: %u", bufferInfo.mMaxUsedLargeBuffers);
+        }
+
         for (const BufferInfoName &info : kBufferInfoNames)
         {
             OutputLine("%s: %u %u %lu", info.mName, (bufferInfo.*info.mQueuePtr).mNumMessages,
@@ -36,6 +36,7 @@
 #include <openthread/heap.h>
 
 #include "common/heap.hpp"
+#include "instance/instance.hpp"
 
 #if OPENTHREAD_RADIO
 
@@ -63,4 +64,15 @@ void otHeapFree(void *aPointer)
 void *otHeapCAlloc(size_t aCount, size_t aSize) { return ot::Heap::CAlloc(aCount, aSize); }
 
 void otHeapFree(void *aPointer) { ot::Heap::Free(aPointer); }
+
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+size_t otHeapGetCapacity(void) { return ot::Instance::GetHeap().GetCapacity(); }
+
+size_t otHeapGetFreeSize(void) { return ot::Instance::GetHeap().GetFreeSize(); }
+
+otError otHeapGetSizeClassInfo(uint8_t aIndex, otHeapSizeClassInfo *aInfo)
+{
+    return ot::Instance::GetHeap().GetSizeClassInfo(aIndex, ot::AsCoreType(aInfo));
+}
+#endif
 #endif // OPENTHREAD_RADIO
@@ -77,13 +77,15 @@ void otMessageSetOrigin(otMessage *aMessage, otMessageOrigin aOrigin)
 
 void otMessageSetDirectTransmission(otMessage *aMessage, bool aEnabled)
 {
+    Message &message = AsCoreType(aMessage);
+
     if (aEnabled)
     {
-        AsCoreType(aMessage).SetDirectTransmission();
+        message.GetInstance().Get<MeshForwarder>().SetDirectTransmission(message);
     }
     else
     {
-        AsCoreType(aMessage).ClearDirectTransmission();
+        message.GetInstance().Get<MeshForwarder>().ClearDirectTransmission(message);
     }
 }
 
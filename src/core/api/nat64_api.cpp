@@ -95,6 +95,13 @@ void otNat64GetErrorCounters(otInstance *aInstance, otNat64ErrorCounters *aCount
     *aCounters = AsCoreType(aInstance).Get<Nat64::Translator>().GetErrorCounters();
 }
 
+void otNat64GetMappingLookupCounters(otInstance *aInstance, otNat64MappingLookupCounters *aCounters)
+{
+    AssertPointerIsNotNull(aCounters);
+
+    *aCounters = AsCoreType(aInstance).Get<Nat64::Translator>().GetMappingLookupCounters();
+}
+
 otError otNat64GetCidr(otInstance *aInstance, otIp4Cidr *aCidr)
 {
     return AsCoreType(aInstance).Get<Nat64::Translator>().GetIp4Cidr(AsCoreType(aCidr));
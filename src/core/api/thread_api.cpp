@@ -437,6 +437,18 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 
 void otThreadResetMleCounters(otInstance *aInstance) { AsCoreType(aInstance).Get<Mle::Mle>().ResetCounters(); }
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+const otKeyCacheCounters *otThreadGetKeyCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<KeyManager>().GetKeyCacheCounters();
+}
+
+void otThreadResetKeyCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<KeyManager>().ResetKeyCacheCounters();
+}
+#endif
+
 uint32_t otThreadGetCurrentAttachDuration(otInstance *aInstance)
 {
     return AsCoreType(aInstance).Get<Mle::Mle>().GetCurrentAttachDuration();
@@ -260,6 +260,16 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
                                                                           AsCoreType(aIterator));
 }
 
+const otAddressCacheCounters *otThreadGetAddressCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<AddressResolver>().GetAddressCacheCounters();
+}
+
+void otThreadResetAddressCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<AddressResolver>().ResetAddressCacheCounters();
+}
+
 void otThreadClearEidCache(otInstance *aInstance) { AsCoreType(aInstance).Get<AddressResolver>().Clear(); }
 
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
@@ -1509,6 +1509,15 @@ bool CoapBase::Request::HasSamePeerAddrAndPort(const Ip6::MessageInfo &aMessageI
            (mMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr());
 }
 
+bool CoapBase::Request::CanMatchResponseFrom(const Ip6::MessageInfo &aMessageInfo) const
+{
+    // A response to a multicast or anycast request can be received
+    // from any peer.
+
+    return HasSamePeerAddrAndPort(aMessageInfo) || GetDestinationAddress().IsMulticast() ||
+           GetDestinationAddress().GetIid().IsAnycastLocator();
+}
+
 bool CoapBase::Request::ShouldRetransmit(void) const { return IsConfirmable() && (mMetadata.mRetxRemaining > 0); }
 
 void CoapBase::Request::UpdateRetxCounterAndTimeout(TimeMilli aNow)
@@ -1538,6 +1547,9 @@ CoapBase::PendingRequests::PendingRequests(Instance &aInstance, CoapBase &aCoapB
     , mDispatchingRequest(nullptr)
     , mTimer(aInstance, HandleTimer, this)
 {
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    ResetIndex();
+#endif
 }
 
 Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
@@ -1567,6 +1579,10 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     mRequestMessages.Enqueue(*aRequest.mMessage);
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    AddToIndex(*aRequest.mMessage, aRequest.GetTimerFireTime());
+#endif
+
     mTimer.FireAtIfEarlier(aRequest.GetTimerFireTime());
 
 exit:
@@ -1577,23 +1593,36 @@ exit:
 void CoapBase::PendingRequests::Remove(Request &aRequest)
 {
     VerifyOrExit(aRequest.HasMessage());
-    mRequestMessages.DequeueAndFree(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
+    aRequest.mMessage->Free();
     aRequest.Clear();
 
 exit:
     return;
 }
 
+void CoapBase::PendingRequests::Dequeue(Message &aMessage)
+{
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    RemoveFromIndex(aMessage);
+#endif
+    mRequestMessages.Dequeue(aMessage);
+}
+
 Error CoapBase::PendingRequests::FindRelatedRequest(const Msg &aMsg, Request &aRequest)
 {
     Error error = kErrorNotFound;
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    error = FindIndexedRequest(aMsg, aRequest);
+    VerifyOrExit((error == kErrorNotFound) && (mNumUnindexed > 0));
+#endif
+
     for (Message &message : mRequestMessages)
     {
         aRequest.InitFrom(message);
 
-        if (aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
-            aRequest.GetDestinationAddress().GetIid().IsAnycastLocator())
+        if (aRequest.CanMatchResponseFrom(aMsg.mMessageInfo))
         {
             switch (aMsg.GetType())
             {
@@ -1633,7 +1662,7 @@ void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult
 {
     VerifyOrExit(aRequest.HasMessage());
 
-    mRequestMessages.Dequeue(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
 
     DispatchResponse(aRequest, aResult, aResponse);
 
@@ -1704,7 +1733,7 @@ Error CoapBase::PendingRequests::AbortAllMatching(const Matcher &aMatcher)
 
         if (aMatcher.Matches(request))
         {
-            mRequestMessages.Dequeue(message);
+            Dequeue(message);
             abortedMessages.Enqueue(message);
             error = kErrorNone;
         }
@@ -1755,10 +1784,36 @@ void CoapBase::PendingRequests::HandleTimer(void)
     NextFireTime nextTime;
     MessageQueue expiredMessages;
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    HandleIndexedTimers(nextTime, expiredMessages);
+
+    if (mNumUnindexed > 0)
+    {
+        HandleTimersByScan(nextTime, expiredMessages);
+    }
+#else
+    HandleTimersByScan(nextTime, expiredMessages);
+#endif
+
+    mTimer.FireAt(nextTime);
+
+    FinalizeRemovedRequestsIn(expiredMessages, kErrorResponseTimeout);
+}
+
+void CoapBase::PendingRequests::HandleTimersByScan(NextFireTime &aNextTime, MessageQueue &aExpiredMessages)
+{
     for (Message &message : mRequestMessages)
     {
         Request request;
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        if (FindIndexEntry(message) != nullptr)
+        {
+            // Indexed requests are handled by `HandleIndexedTimers()`.
+            continue;
+        }
+#endif
+
         request.InitFrom(message);
 
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
@@ -1771,37 +1826,382 @@ void CoapBase::PendingRequests::HandleTimer(void)
         }
 #endif
 
-        if (nextTime.GetNow() >= request.GetTimerFireTime())
+        if (HandleTimerFor(request, aNextTime.GetNow()))
+        {
+            // We move the expired request to a separate queue to
+            // finalize it after the loop. This ensures that the
+            // iterator over `mRequestMessages` remains valid
+            // even if the user callback (invoked during
+            // finalization) modifies any pending requests
+
+            Dequeue(message);
+            aExpiredMessages.Enqueue(message);
+            continue;
+        }
+
+        aNextTime.UpdateIfEarlier(request.GetTimerFireTime());
+    }
+}
+
+bool CoapBase::PendingRequests::HandleTimerFor(Request &aRequest, TimeMilli aNow)
+{
+    // Retransmits `aRequest` if its timer fire time is reached.
+    // Returns `true` if the request has timed out (no more
+    // retransmissions) and needs to be finalized.
+
+    bool timedOut = false;
+
+    VerifyOrExit(aNow >= aRequest.GetTimerFireTime());
+
+    if (!aRequest.ShouldRetransmit())
+    {
+        timedOut = true;
+        ExitNow();
+    }
+
+    aRequest.UpdateRetxCounterAndTimeout(aNow);
+
+    if (!aRequest.IsAcknowledged())
+    {
+        RetransmitRequest(aRequest);
+    }
+
+exit:
+    return timedOut;
+}
+
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+
+void CoapBase::PendingRequests::HandleIndexedTimers(NextFireTime &aNextTime, MessageQueue &aExpiredMessages)
+{
+    // Handles the indexed requests whose timer fire time is reached,
+    // in the order of their fire time. The top of `mHeap` is always
+    // the indexed request with the earliest fire time, so requests
+    // which are not yet due are not visited.
+
+    while ((mHeapSize > 0) && (aNextTime.GetNow() >= mHeap[0]->mFireTime))
+    {
+        IndexEntry &entry   = *mHeap[0];
+        Message    &message = *entry.mMessage;
+        Request     request;
+
+        HeapRemove(entry);
+        request.InitFrom(message);
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (request.IsObserveSubscription())
+        {
+            // An acknowledged RFC7641 subscription is not timed out.
+            // It stays in the index (for matching responses) but is
+            // not added back to the heap.
+            continue;
+        }
+#endif
+
+        if (HandleTimerFor(request, aNextTime.GetNow()))
+        {
+            Dequeue(message);
+            aExpiredMessages.Enqueue(message);
+            continue;
+        }
+
+        entry.mFireTime = request.GetTimerFireTime();
+        HeapPush(entry);
+    }
+
+    if (mHeapSize > 0)
+    {
+        aNextTime.UpdateIfEarlier(mHeap[0]->mFireTime);
+    }
+}
+
+void CoapBase::PendingRequests::ResetIndex(void)
+{
+    mFreeEntries  = nullptr;
+    mHeapSize     = 0;
+    mNumUnindexed = 0;
+
+    for (IndexEntry *&bucket : mTokenBuckets)
+    {
+        bucket = nullptr;
+    }
+
+    for (IndexEntry *&bucket : mMessageIdBuckets)
+    {
+        bucket = nullptr;
+    }
+
+    for (IndexEntry &entry : mEntries)
+    {
+        entry.mNextByToken = mFreeEntries;
+        mFreeEntries       = &entry;
+    }
+}
+
+void CoapBase::PendingRequests::AddToIndex(Message &aMessage, TimeMilli aFireTime)
+{
+    // Adds the new pending request `aMessage` to the index. If there
+    // is no free entry, the request is tracked as unindexed and is
+    // handled by scanning `mRequestMessages`.
+
+    IndexEntry *entry = mFreeEntries;
+
+    if (entry == nullptr)
+    {
+        mNumUnindexed++;
+        ExitNow();
+    }
+
+    mFreeEntries = entry->mNextByToken;
+
+    entry->mMessage   = &aMessage;
+    entry->mFireTime  = aFireTime;
+    entry->mTokenHash = CalculateTokenHash(aMessage);
+    entry->mMessageId = aMessage.ReadMessageId();
+
+    entry->mNextByToken     = GetTokenBucket(entry->mTokenHash);
+    entry->mNextByMessageId = GetMessageIdBucket(entry->mMessageId);
+
+    GetTokenBucket(entry->mTokenHash)     = entry;
+    GetMessageIdBucket(entry->mMessageId) = entry;
+
+    HeapPush(*entry);
+
+exit:
+    return;
+}
+
+void CoapBase::PendingRequests::RemoveFromIndex(const Message &aMessage)
+{
+    IndexEntry  *entry = FindIndexEntry(aMessage);
+    IndexEntry **entryPtr;
+
+    if (entry == nullptr)
+    {
+        mNumUnindexed--;
+        ExitNow();
+    }
+
+    entryPtr = &GetTokenBucket(entry->mTokenHash);
+
+    while (*entryPtr != entry)
+    {
+        entryPtr = &(*entryPtr)->mNextByToken;
+    }
+
+    *entryPtr = entry->mNextByToken;
+    entryPtr  = &GetMessageIdBucket(entry->mMessageId);
+
+    while (*entryPtr != entry)
+    {
+        entryPtr = &(*entryPtr)->mNextByMessageId;
+    }
+
+    *entryPtr = entry->mNextByMessageId;
+
+    if (entry->mHeapIndex != kNotInHeap)
+    {
+        HeapRemove(*entry);
+    }
+
+    entry->mNextByToken = mFreeEntries;
+    mFreeEntries        = entry;
+
+exit:
+    return;
+}
+
+CoapBase::PendingRequests::IndexEntry *CoapBase::PendingRequests::FindIndexEntry(const Message &aMessage)
+{
+    IndexEntry *entry = GetTokenBucket(CalculateTokenHash(aMessage));
+
+    while ((entry != nullptr) && (entry->mMessage != &aMessage))
+    {
+        entry = entry->mNextByToken;
+    }
+
+    return entry;
+}
+
+Error CoapBase::PendingRequests::FindIndexedRequest(const Msg &aMsg, Request &aRequest)
+{
+    // Matches `aMsg` against the indexed requests using the same
+    // rules as `FindRelatedRequest()`: Ack and Reset messages are
+    // matched by message ID, Confirmable and Non-confirmable by
+    // token.
+
+    Error error = kErrorNotFound;
+
+    switch (aMsg.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+    {
+        uint16_t messageId = aMsg.GetMessageId();
+
+        for (IndexEntry *entry = GetMessageIdBucket(messageId); entry != nullptr; entry = entry->mNextByMessageId)
+        {
+            if (entry->mMessageId != messageId)
+            {
+                continue;
+            }
+
+            aRequest.InitFrom(*entry->mMessage);
+
+            if (aRequest.CanMatchResponseFrom(aMsg.mMessageInfo))
+            {
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+        break;
+    }
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+    {
+        uint32_t hash = CalculateTokenHash(aMsg.GetToken());
+
+        for (IndexEntry *entry = GetTokenBucket(hash); entry != nullptr; entry = entry->mNextByToken)
         {
-            if (!request.ShouldRetransmit())
+            if ((entry->mTokenHash != hash) || !aMsg.mMessage.HasSameTokenAs(*entry->mMessage))
             {
-                // We move the expired request to a separate queue to
-                // finalize it after the loop. This ensures that the
-                // iterator over `mRequestMessages` remains valid
-                // even if the user callback (invoked during
-                // finalization) modifies any pending requests
-
-                mRequestMessages.Dequeue(message);
-                expiredMessages.Enqueue(message);
                 continue;
             }
 
-            request.UpdateRetxCounterAndTimeout(nextTime.GetNow());
+            aRequest.InitFrom(*entry->mMessage);
 
-            if (!request.IsAcknowledged())
+            if (aRequest.CanMatchResponseFrom(aMsg.mMessageInfo))
             {
-                RetransmitRequest(request);
+                ExitNow(error = kErrorNone);
             }
         }
 
-        nextTime.UpdateIfEarlier(request.GetTimerFireTime());
+        break;
+    }
     }
 
-    mTimer.FireAt(nextTime);
+    aRequest.Clear();
 
-    FinalizeRemovedRequestsIn(expiredMessages, kErrorResponseTimeout);
+exit:
+    return error;
+}
+
+void CoapBase::PendingRequests::HeapPush(IndexEntry &aEntry)
+{
+    OT_ASSERT(mHeapSize < kIndexSize);
+
+    HeapSet(mHeapSize, aEntry);
+    mHeapSize++;
+    HeapMoveUp(aEntry.mHeapIndex);
+}
+
+void CoapBase::PendingRequests::HeapRemove(IndexEntry &aEntry)
+{
+    uint16_t index = aEntry.mHeapIndex;
+
+    mHeapSize--;
+    aEntry.mHeapIndex = kNotInHeap;
+
+    VerifyOrExit(index != mHeapSize);
+
+    // Move the last entry into the vacated slot and restore the
+    // heap order. At most one of `HeapMoveUp()` and `HeapMoveDown()`
+    // moves the entry; the other one is then a no-op.
+
+    HeapSet(index, *mHeap[mHeapSize]);
+    HeapMoveUp(index);
+    HeapMoveDown(index);
+
+exit:
+    return;
 }
 
+void CoapBase::PendingRequests::HeapMoveUp(uint16_t aIndex)
+{
+    IndexEntry *entry = mHeap[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint16_t parent = (aIndex - 1) / 2;
+
+        if (!(entry->mFireTime < mHeap[parent]->mFireTime))
+        {
+            break;
+        }
+
+        HeapSet(aIndex, *mHeap[parent]);
+        aIndex = parent;
+    }
+
+    HeapSet(aIndex, *entry);
+}
+
+void CoapBase::PendingRequests::HeapMoveDown(uint16_t aIndex)
+{
+    IndexEntry *entry = mHeap[aIndex];
+
+    while (true)
+    {
+        uint16_t child = 2 * aIndex + 1;
+
+        if (child >= mHeapSize)
+        {
+            break;
+        }
+
+        if ((child + 1 < mHeapSize) && (mHeap[child + 1]->mFireTime < mHeap[child]->mFireTime))
+        {
+            child++;
+        }
+
+        if (!(mHeap[child]->mFireTime < entry->mFireTime))
+        {
+            break;
+        }
+
+        HeapSet(aIndex, *mHeap[child]);
+        aIndex = child;
+    }
+
+    HeapSet(aIndex, *entry);
+}
+
+void CoapBase::PendingRequests::HeapSet(uint16_t aIndex, IndexEntry &aEntry)
+{
+    mHeap[aIndex]     = &aEntry;
+    aEntry.mHeapIndex = aIndex;
+}
+
+uint32_t CoapBase::PendingRequests::CalculateTokenHash(const Token &aToken)
+{
+    // Calculates the FNV-1a hash of the token bytes.
+
+    static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    static constexpr uint32_t kFnvPrime       = 16777619u;
+
+    uint32_t hash = kFnvOffsetBasis;
+
+    for (uint8_t index = 0; index < aToken.GetLength(); index++)
+    {
+        hash = (hash ^ aToken.GetBytes()[index]) * kFnvPrime;
+    }
+
+    return hash;
+}
+
+uint32_t CoapBase::PendingRequests::CalculateTokenHash(const Message &aMessage)
+{
+    Token token;
+
+    token.Clear();
+    IgnoreError(aMessage.ReadToken(token));
+
+    return CalculateTokenHash(token);
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // CoapBase::PendingRequests::Matcher
 
@@ -1833,6 +2233,8 @@ exit:
 CoapBase::ResponseCache::ResponseCache(Instance &aInstance)
     : mTimer(aInstance, ResponseCache::HandleTimer, this)
 {
+    ResetIndex();
+    mCounters.Clear();
 }
 
 Error CoapBase::ResponseCache::SendCachedResponse(const Msg &aRxMsg, CoapBase &aCoapBase)
@@ -1846,7 +2248,13 @@ Error CoapBase::ResponseCache::SendCachedResponse(const Msg &aRxMsg, CoapBase &a
     const Message *match    = FindMatching(aRxMsg);
     Message       *response = nullptr;
 
-    VerifyOrExit(match != nullptr, error = kErrorNotFound);
+    if (match == nullptr)
+    {
+        mCounters.mMisses++;
+        ExitNow(error = kErrorNotFound);
+    }
+
+    mCounters.mHits++;
 
     response = aCoapBase.CloneMessageWithout<ResponseMetadata>(*match);
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
@@ -1858,24 +2266,51 @@ exit:
     return error;
 }
 
+uint32_t CoapBase::ResponseCache::CalculateHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    // Calculates the FNV-1a hash of the message ID and the peer
+    // address and port.
+
+    static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    static constexpr uint32_t kFnvPrime       = 16777619u;
+
+    uint32_t       hash  = kFnvOffsetBasis;
+    const uint8_t *bytes = aMessageInfo.GetPeerAddr().GetBytes();
+
+    for (uint8_t index = 0; index < sizeof(Ip6::Address); index++)
+    {
+        hash = (hash ^ bytes[index]) * kFnvPrime;
+    }
+
+    hash = (hash ^ (aMessageInfo.GetPeerPort() >> 8)) * kFnvPrime;
+    hash = (hash ^ (aMessageInfo.GetPeerPort() & 0xff)) * kFnvPrime;
+    hash = (hash ^ (aMessageId >> 8)) * kFnvPrime;
+    hash = (hash ^ (aMessageId & 0xff)) * kFnvPrime;
+
+    return hash;
+}
+
 const Message *CoapBase::ResponseCache::FindMatching(const Msg &aRxMsg) const
 {
     const Message *match        = nullptr;
     uint16_t       requestMsgId = aRxMsg.GetMessageId();
+    uint32_t       hash         = CalculateHash(requestMsgId, aRxMsg.mMessageInfo);
 
-    for (const Message &response : mResponses)
+    for (const IndexEntry *entry = mBuckets[hash % kNumBuckets]; entry != nullptr; entry = entry->mNext)
     {
-        if (response.ReadMessageId() == requestMsgId)
+        ResponseMetadata metadata;
+
+        if ((entry->mHash != hash) || (entry->mResponse->ReadMessageId() != requestMsgId))
         {
-            ResponseMetadata metadata;
+            continue;
+        }
 
-            metadata.ReadFrom(response);
+        metadata.ReadFrom(*entry->mResponse);
 
-            if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
-            {
-                match = &response;
-                break;
-            }
+        if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
+        {
+            match = entry->mResponse;
+            break;
         }
     }
 
@@ -1888,11 +2323,14 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
     // entry does not already exist.
 
     Message         *responseClone = nullptr;
+    uint16_t         length        = aTxMsg.mMessage.GetLength();
+    IndexEntry      *entry;
     ResponseMetadata metadata;
 
     VerifyOrExit(FindMatching(aTxMsg) == nullptr);
+    VerifyOrExit((kMaxCacheBytes == 0) || (length <= kMaxCacheBytes));
 
-    MaintainCacheSize();
+    MakeRoomFor(length);
 
     responseClone = AsCoapMessagePtr(aTxMsg.mMessage.Clone<kNoReservedHeader>());
     VerifyOrExit(responseClone != nullptr);
@@ -1902,7 +2340,17 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
 
     SuccessOrExit(metadata.AppendTo(*responseClone));
 
+    entry        = mFreeEntries;
+    mFreeEntries = entry->mNext;
+
+    entry->mResponse = responseClone;
+    entry->mHash     = CalculateHash(aTxMsg.GetMessageId(), aTxMsg.mMessageInfo);
+    entry->mNext     = GetBucket(entry->mHash);
+
+    GetBucket(entry->mHash) = entry;
+
     mResponses.Enqueue(*responseClone);
+    mCachedBytes += length;
     responseClone = nullptr;
 
     mTimer.FireAtIfEarlier(metadata.mExpireTime);
@@ -1911,40 +2359,87 @@ exit:
     FreeMessage(responseClone);
 }
 
-void CoapBase::ResponseCache::MaintainCacheSize(void)
+void CoapBase::ResponseCache::MakeRoomFor(uint16_t aLength)
 {
-    // Checks the cache size. If the limit (`kMaxCacheSize`) is
-    // reached, removes the entry with the earliest expire time.
-
-    uint16_t  count       = 0;
-    Message  *msgToRemove = nullptr;
-    TimeMilli earliestExpireTime;
+    // Removes the entries with the earliest expire time until there
+    // is a free entry and the total size of cached responses along
+    // with the new response of `aLength` is within the limit
+    // (`kMaxCacheBytes`).
 
-    for (Message &response : mResponses)
+    while ((mFreeEntries == nullptr) || ((kMaxCacheBytes != 0) && (mCachedBytes + aLength > kMaxCacheBytes)))
     {
-        ResponseMetadata metadata;
+        Message  *msgToRemove = nullptr;
+        TimeMilli earliestExpireTime;
 
-        metadata.ReadFrom(response);
+        for (Message &response : mResponses)
+        {
+            ResponseMetadata metadata;
+
+            metadata.ReadFrom(response);
 
-        if ((msgToRemove == nullptr) || (metadata.mExpireTime < earliestExpireTime))
+            if ((msgToRemove == nullptr) || (metadata.mExpireTime < earliestExpireTime))
+            {
+                msgToRemove        = &response;
+                earliestExpireTime = metadata.mExpireTime;
+            }
+        }
+
+        if (msgToRemove == nullptr)
         {
-            msgToRemove        = &response;
-            earliestExpireTime = metadata.mExpireTime;
+            break;
         }
 
-        count++;
+        Remove(*msgToRemove);
+        mCounters.mEvictions++;
     }
+}
 
-    if (count >= kMaxCacheSize)
+void CoapBase::ResponseCache::Remove(Message &aResponse)
+{
+    ResponseMetadata metadata;
+
+    metadata.ReadFrom(aResponse);
+
+    for (IndexEntry **entryPtr = &GetBucket(CalculateHash(aResponse.ReadMessageId(), metadata.mMessageInfo));
+         *entryPtr != nullptr; entryPtr = &(*entryPtr)->mNext)
     {
-        mResponses.DequeueAndFree(*msgToRemove);
+        IndexEntry *entry = *entryPtr;
+
+        if (entry->mResponse == &aResponse)
+        {
+            *entryPtr    = entry->mNext;
+            entry->mNext = mFreeEntries;
+            mFreeEntries = entry;
+            break;
+        }
     }
+
+    mCachedBytes -= aResponse.GetLength() - sizeof(ResponseMetadata);
+    mResponses.DequeueAndFree(aResponse);
 }
 
 void CoapBase::ResponseCache::RemoveAll(void)
 {
     mResponses.DequeueAndFreeAll();
     mTimer.Stop();
+    ResetIndex();
+}
+
+void CoapBase::ResponseCache::ResetIndex(void)
+{
+    mFreeEntries = nullptr;
+    mCachedBytes = 0;
+
+    for (IndexEntry *&bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+
+    for (IndexEntry &entry : mEntries)
+    {
+        entry.mNext  = mFreeEntries;
+        mFreeEntries = &entry;
+    }
 }
 
 void CoapBase::ResponseCache::HandleTimer(Timer &aTimer)
@@ -1964,7 +2459,7 @@ void CoapBase::ResponseCache::HandleTimer(void)
 
         if (expireTime.GetNow() >= metadata.mExpireTime)
         {
-            mResponses.DequeueAndFree(response);
+            Remove(response);
         }
         else
         {
@@ -36,12 +36,14 @@
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/clearable.hpp"
 #include "common/debug.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/message_allocator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/owned_ptr.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
@@ -286,6 +288,16 @@ protected:
 
 #endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
+/**
+ * Represents the CoAP response cache counters.
+ */
+struct ResponseCacheCounters : public Clearable<ResponseCacheCounters>
+{
+    uint32_t mHits;      ///< Number of received requests answered using a cached response.
+    uint32_t mMisses;    ///< Number of received requests with no matching cached response.
+    uint32_t mEvictions; ///< Number of cached responses removed before their expiration to make room for new ones.
+};
+
 /**
  * Implements the CoAP client and server.
  */
@@ -294,6 +306,8 @@ class CoapBase
       public MessageAllocator<CoapBase, ReservedHeaderSize::kCoapMessage, Message::kTypeIp6, ot::Coap::Message>,
       private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     /**
      * Function pointer callback invoked before CoAP processing a received CoAP message.
@@ -695,6 +709,18 @@ public:
      */
     void GetRequestAndCachedResponsesQueueInfo(MessageQueue::Info &aQueueInfo) const;
 
+    /**
+     * Returns the response cache counters.
+     *
+     * @returns The response cache counters.
+     */
+    const ResponseCacheCounters &GetResponseCacheCounters(void) const { return mResponseCache.GetCounters(); }
+
+    /**
+     * Resets the response cache counters.
+     */
+    void ResetResponseCacheCounters(void) { mResponseCache.ResetCounters(); }
+
     /**
      * Sends a CoAP message with custom transmission parameters using `ResponseHandlerSeparateParams` handle type.
      *
@@ -838,6 +864,7 @@ private:
         void MarkAsAcknowledged(void);
         bool IsConfirmable(void) const { return mMetadata.mConfirmable; }
         bool HasSamePeerAddrAndPort(const Ip6::MessageInfo &aMessageInfo) const;
+        bool CanMatchResponseFrom(const Ip6::MessageInfo &aMessageInfo) const;
         bool ShouldRetransmit(void) const;
         void UpdateRetxCounterAndTimeout(TimeMilli aNow);
         bool HasResponseHandler(void) const { return GetCallbacks().HasResponseHandler(); }
@@ -896,6 +923,8 @@ private:
 
     class PendingRequests
     {
+        friend class ot::UnitTester;
+
         struct Iterator;
 
     public:
@@ -940,33 +969,94 @@ private:
             void               *mContext;
         };
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        static constexpr uint16_t kIndexSize  = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE;
+        static constexpr uint16_t kNumBuckets = kIndexSize;
+        static constexpr uint16_t kNotInHeap  = NumericLimits<uint16_t>::kMax;
+
+        static_assert(kIndexSize != 0, "OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE MUST be non-zero");
+
+        struct IndexEntry
+        {
+            // Indexes a pending request (in `mRequestMessages`) by the
+            // hash of its token and by its message ID. `mFireTime` is
+            // the timer fire time of the request, used as the key in
+            // the min-heap `mHeap`.
+
+            IndexEntry *mNextByToken;
+            IndexEntry *mNextByMessageId;
+            Message    *mMessage;
+            TimeMilli   mFireTime;
+            uint32_t    mTokenHash;
+            uint16_t    mMessageId;
+            uint16_t    mHeapIndex;
+        };
+#endif
+
+        void        Dequeue(Message &aMessage);
         Error       AbortAllMatching(const Matcher &aMatcher);
         void        FinalizeRemovedRequestsIn(MessageQueue &aQueue, Error aResult);
         void        RetransmitRequest(const Request &aRequest);
+        bool        HandleTimerFor(Request &aRequest, TimeMilli aNow);
+        void        HandleTimersByScan(NextFireTime &aNextTime, MessageQueue &aExpiredMessages);
         static void HandleTimer(Timer &aTimer);
         void        HandleTimer(void);
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
         Error ProcessObserveSend(const Msg &aTxMsg, Request &aRequest);
 #endif
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        void        ResetIndex(void);
+        void        AddToIndex(Message &aMessage, TimeMilli aFireTime);
+        void        RemoveFromIndex(const Message &aMessage);
+        IndexEntry *FindIndexEntry(const Message &aMessage);
+        Error       FindIndexedRequest(const Msg &aMsg, Request &aRequest);
+        void        HandleIndexedTimers(NextFireTime &aNextTime, MessageQueue &aExpiredMessages);
+        void        HeapPush(IndexEntry &aEntry);
+        void        HeapRemove(IndexEntry &aEntry);
+        void        HeapMoveUp(uint16_t aIndex);
+        void        HeapMoveDown(uint16_t aIndex);
+        void        HeapSet(uint16_t aIndex, IndexEntry &aEntry);
+
+        IndexEntry *&GetTokenBucket(uint32_t aTokenHash) { return mTokenBuckets[aTokenHash % kNumBuckets]; }
+        IndexEntry *&GetMessageIdBucket(uint16_t aMessageId) { return mMessageIdBuckets[aMessageId % kNumBuckets]; }
+
+        static uint32_t CalculateTokenHash(const Token &aToken);
+        static uint32_t CalculateTokenHash(const Message &aMessage);
+#endif
 
         CoapBase         &mCoapBase;
         MessageQueue      mRequestMessages;
         const Request    *mDispatchingRequest;
         TimerMilliContext mTimer;
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        IndexEntry  mEntries[kIndexSize];
+        IndexEntry *mFreeEntries;
+        IndexEntry *mTokenBuckets[kNumBuckets];
+        IndexEntry *mMessageIdBuckets[kNumBuckets];
+        IndexEntry *mHeap[kIndexSize];
+        uint16_t    mHeapSize;
+        uint16_t    mNumUnindexed;
+#endif
     };
 
     class ResponseCache
     {
+        friend class ot::UnitTester;
+
     public:
         explicit ResponseCache(Instance &aInstance);
 
-        void  Add(const Msg &aTxMsg, uint32_t aExchangeLifetime);
-        void  RemoveAll(void);
-        Error SendCachedResponse(const Msg &aRxMsg, CoapBase &aCoapBase);
-        void  GetInfo(MessageQueue::Info &aInfo) const { mResponses.GetInfo(aInfo); }
+        void                         Add(const Msg &aTxMsg, uint32_t aExchangeLifetime);
+        void                         RemoveAll(void);
+        Error                        SendCachedResponse(const Msg &aRxMsg, CoapBase &aCoapBase);
+        void                         GetInfo(MessageQueue::Info &aInfo) const { mResponses.GetInfo(aInfo); }
+        const ResponseCacheCounters &GetCounters(void) const { return mCounters; }
+        void                         ResetCounters(void) { mCounters.Clear(); }
 
     private:
-        static constexpr uint16_t kMaxCacheSize = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+        static constexpr uint16_t kMaxCacheSize  = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+        static constexpr uint32_t kMaxCacheBytes = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_BYTES;
+        static constexpr uint16_t kNumBuckets    = kMaxCacheSize;
 
         static_assert(kMaxCacheSize != 0, "kMaxCacheSize MUST be non-zero");
 
@@ -976,13 +1066,33 @@ private:
             Ip6::MessageInfo mMessageInfo;
         };
 
+        struct IndexEntry
+        {
+            // Indexes a cached response (in `mResponses`) by the hash
+            // of its message ID and peer address and port.
+
+            IndexEntry *mNext;
+            Message    *mResponse;
+            uint32_t    mHash;
+        };
+
         const Message *FindMatching(const Msg &aRxMsg) const;
-        void           MaintainCacheSize(void);
+        void           Remove(Message &aResponse);
+        void           MakeRoomFor(uint16_t aLength);
+        void           ResetIndex(void);
+        IndexEntry   *&GetBucket(uint32_t aHash) { return mBuckets[aHash % kNumBuckets]; }
         static void    HandleTimer(Timer &aTimer);
         void           HandleTimer(void);
 
-        MessageQueue      mResponses;
-        TimerMilliContext mTimer;
+        static uint32_t CalculateHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+
+        MessageQueue          mResponses;
+        IndexEntry            mEntries[kMaxCacheSize];
+        IndexEntry           *mFreeEntries;
+        IndexEntry           *mBuckets[kNumBuckets];
+        uint32_t              mCachedBytes;
+        ResponseCacheCounters mCounters;
+        TimerMilliContext     mTimer;
     };
 
     Message *InitMessage(Message *aMessage, Type aType, Uri aUri);
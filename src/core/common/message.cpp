@@ -41,6 +41,10 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE && OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+#error "OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
+#endif
+
 namespace ot {
 
 RegisterLogModule("Message");
@@ -52,6 +56,10 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNumAllocated(0)
     , mMaxAllocated(0)
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    , mNumLargeAllocated(0)
+    , mMaxLargeAllocated(0)
+#endif
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
@@ -105,6 +113,7 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(!aMessage->IsInAQueue());
 
+    aMessage->FreeBuffersAfter(*aMessage);
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
@@ -157,6 +166,89 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
     }
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
+Buffer *MessagePool::NewLargeBuffer(Message::Priority aPriority)
+{
+    LargeBuffer *buffer = nullptr;
+
+    while ((
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+               buffer = static_cast<LargeBuffer *>(Heap::CAlloc(1, sizeof(LargeBuffer)))
+#else
+               buffer = mLargeBufferPool.Allocate()
+#endif
+                   ) == nullptr)
+    {
+        SuccessOrExit(ReclaimBuffers(aPriority));
+    }
+
+    mNumLargeAllocated++;
+    mMaxLargeAllocated = Max(mMaxLargeAllocated, mNumLargeAllocated);
+
+    buffer->SetNext(nullptr);
+
+exit:
+    if (buffer == nullptr)
+    {
+        LogInfo("No available large message buffer");
+    }
+
+    return (buffer != nullptr) ? &buffer->AsBuffer() : nullptr;
+}
+
+void MessagePool::FreeLargeBuffers(Buffer *aBuffer)
+{
+    while (aBuffer != nullptr)
+    {
+        Buffer *next = aBuffer->GetNextBuffer();
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+        Heap::Free(&LargeBuffer::From(*aBuffer));
+#else
+        mLargeBufferPool.Free(LargeBuffer::From(*aBuffer));
+#endif
+        mNumLargeAllocated--;
+
+        aBuffer = next;
+    }
+}
+
+uint16_t MessagePool::GetFreeLargeBufferCount(void) const
+{
+    uint16_t rval;
+
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+#if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    rval = static_cast<uint16_t>(Instance::GetHeap().GetFreeSize() / sizeof(LargeBuffer));
+#else
+    SetToUintMax(rval);
+#endif
+#else
+    rval = kNumLargeBuffers - mNumLargeAllocated;
+#endif
+
+    return rval;
+}
+
+uint16_t MessagePool::GetTotalLargeBufferCount(void) const
+{
+    uint16_t rval;
+
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+#if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    rval = static_cast<uint16_t>(Instance::GetHeap().GetCapacity() / sizeof(LargeBuffer));
+#else
+    SetToUintMax(rval);
+#endif
+#else
+    rval = kNumLargeBuffers;
+#endif
+
+    return rval;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
     return Get<MeshForwarder>().EvictMessage(aPriority, MeshForwarder::kEvictReasonNoMessageBuffer);
@@ -233,31 +325,70 @@ Error Message::ResizeMessage(uint16_t aLength)
 
     Error    error     = kErrorNone;
     Buffer  *curBuffer = this;
-    Buffer  *lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    // The buffer class is selected when the first buffer is added
+    // after the head buffer. Large buffers are used if the message
+    // would otherwise need more than two buffers and a large buffer
+    // is readily available (no message is evicted to get one).
+
+    if ((GetNextBuffer() == nullptr) && (curLength < aLength))
+    {
+        GetMetadata().mLargeBuffers = (aLength - curLength > kBufferDataSize) &&
+                                      (Get<MessagePool>().GetFreeLargeBufferCount() > 0);
+    }
+#endif
+
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
-            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority()));
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+            if (GetMetadata().mLargeBuffers)
+            {
+                curBuffer->SetNextBuffer(Get<MessagePool>().NewLargeBuffer(GetPriority()));
+            }
+            else
+#endif
+            {
+                curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority()));
+            }
+
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+        curLength += GetBufferDataSize();
     }
 
-    lastBuffer = curBuffer;
-    curBuffer  = curBuffer->GetNextBuffer();
-    lastBuffer->SetNextBuffer(nullptr);
-
-    Get<MessagePool>().FreeBuffers(curBuffer);
+    FreeBuffersAfter(*curBuffer);
 
 exit:
     return error;
 }
 
+void Message::FreeBuffersAfter(Buffer &aBuffer)
+{
+    Buffer *next = aBuffer.GetNextBuffer();
+
+    aBuffer.SetNextBuffer(nullptr);
+
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    if (GetMetadata().mLargeBuffers)
+    {
+        Get<MessagePool>().FreeLargeBuffers(next);
+        ExitNow();
+    }
+#endif
+
+    Get<MessagePool>().FreeBuffers(next);
+    ExitNow();
+
+exit:
+    return;
+}
+
 void Message::Free(void)
 {
     // `TxCallback` is cleared once it is invoked. If the message is
@@ -428,19 +559,32 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+        if (GetMetadata().mLargeBuffers)
+        {
+            newBuffer = Get<MessagePool>().NewLargeBuffer(GetPriority());
+        }
+        else
+#endif
+        {
+            newBuffer = Get<MessagePool>().NewBuffer(GetPriority());
+        }
+
+        VerifyOrExit(newBuffer != nullptr, error = kErrorNoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
 
-        if (GetReserved() < sizeof(mBuffer.mHead.mData))
+        if (GetReserved() < kHeadBufferDataSize)
         {
-            // Copy payload from the first buffer.
-            memcpy(newBuffer->mBuffer.mHead.mData + GetReserved(), mBuffer.mHead.mData + GetReserved(),
-                   sizeof(mBuffer.mHead.mData) - GetReserved());
+            // Copy payload from the first buffer. The new buffer is
+            // inserted after the first one, so the payload moves to
+            // the end of the new buffer.
+            memcpy(GetBufferData(*newBuffer) + GetBufferDataSize() - kHeadBufferDataSize + GetReserved(),
+                   GetFirstData() + GetReserved(), kHeadBufferDataSize - GetReserved());
         }
 
-        SetReserved(GetReserved() + kBufferDataSize);
+        SetReserved(GetReserved() + GetBufferDataSize());
     }
 
     SetReserved(GetReserved() - aLength);
@@ -574,13 +718,13 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
 
         OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-        if (aOffset < kBufferDataSize)
+        if (aOffset < GetBufferDataSize())
         {
-            aChunk.Init(aChunk.GetBuffer()->GetData() + aOffset, kBufferDataSize - aOffset);
+            aChunk.Init(GetBufferData(*aChunk.GetBuffer()) + aOffset, GetBufferDataSize() - aOffset);
             ExitNow();
         }
 
-        aOffset -= kBufferDataSize;
+        aOffset -= GetBufferDataSize();
     }
 
 exit:
@@ -606,7 +750,7 @@ void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 
     OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-    aChunk.Init(aChunk.GetBuffer()->GetData(), kBufferDataSize);
+    aChunk.Init(GetBufferData(*aChunk.GetBuffer()), GetBufferDataSize());
 
     if (aChunk.GetLength() > aLength)
     {
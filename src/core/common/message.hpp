@@ -147,6 +147,7 @@ class PlatTcp;
     } while (false)
 
 class Message;
+class MeshForwarder;
 class MessagePool;
 class MessageQueue;
 class PriorityQueue;
@@ -222,6 +223,9 @@ protected:
 #endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         bool mTimeSync : 1; // Whether the message is also used for time sync purpose.
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+        bool mLargeBuffers : 1; // Whether the buffers after the first one are `LargeBuffer`s.
 #endif
         uint8_t mPriority : 2; // The message priority level (higher value is higher priority).
         uint8_t mOrigin : 2;   // The origin of the message.
@@ -286,6 +290,64 @@ private:
 static_assert(sizeof(Buffer) >= Buffer::kSize,
               "Buffer size is not valid. Increase OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE.");
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
+/**
+ * Represents a large message buffer.
+ *
+ * A `LargeBuffer` is never the first buffer of a message. It starts with the same `otMessageBuffer` header as `Buffer`
+ * so that it can be chained in the list of buffers of a message, which then uses `LargeBuffer` for all the buffers
+ * following its first one.
+ */
+class LargeBuffer : public otMessageBuffer, public LinkedListEntry<LargeBuffer>
+{
+    friend class Message;
+
+public:
+    static constexpr uint16_t kSize = OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE; ///< Size of buffer in bytes.
+
+    /**
+     * Returns the `LargeBuffer` chained as a given `Buffer`.
+     *
+     * @param[in] aBuffer  A buffer (in the list of buffers of a message using large buffers).
+     *
+     * @returns The `LargeBuffer` corresponding to @p aBuffer.
+     */
+    static LargeBuffer &From(Buffer &aBuffer)
+    {
+        return *static_cast<LargeBuffer *>(static_cast<otMessageBuffer *>(&aBuffer));
+    }
+
+    /**
+     * Returns the `LargeBuffer` chained as a given `Buffer`.
+     *
+     * @param[in] aBuffer  A buffer (in the list of buffers of a message using large buffers).
+     *
+     * @returns The `LargeBuffer` corresponding to @p aBuffer.
+     */
+    static const LargeBuffer &From(const Buffer &aBuffer)
+    {
+        return *static_cast<const LargeBuffer *>(static_cast<const otMessageBuffer *>(&aBuffer));
+    }
+
+    /**
+     * Returns the `LargeBuffer` as a `Buffer` to be chained in the list of buffers of a message.
+     *
+     * @returns The `LargeBuffer` as a `Buffer`.
+     */
+    Buffer &AsBuffer(void) { return *static_cast<Buffer *>(static_cast<otMessageBuffer *>(this)); }
+
+private:
+    static constexpr uint16_t kDataSize = kSize - sizeof(otMessageBuffer);
+
+    uint8_t mData[kDataSize];
+};
+
+static_assert(LargeBuffer::kSize > 2 * Buffer::kSize,
+              "OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE should be larger than two message buffers");
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
 /**
  * Represents a message.
  */
@@ -298,6 +360,7 @@ class Message : public otMessage, public Buffer, public GetProvider<Message>
     friend class Crypto::Sha256;
     friend class Crypto::AesCcm;
     friend class Ip6::PlatTcp;
+    friend class MeshForwarder;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -1684,6 +1747,26 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+    void  FreeBuffersAfter(Buffer &aBuffer);
+
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    uint16_t GetBufferDataSize(void) const
+    {
+        return GetMetadata().mLargeBuffers ? LargeBuffer::kDataSize : kBufferDataSize;
+    }
+    const uint8_t *GetBufferData(const Buffer &aBuffer) const
+    {
+        return GetMetadata().mLargeBuffers ? LargeBuffer::From(aBuffer).mData : aBuffer.GetData();
+    }
+    uint8_t *GetBufferData(Buffer &aBuffer)
+    {
+        return GetMetadata().mLargeBuffers ? LargeBuffer::From(aBuffer).mData : aBuffer.GetData();
+    }
+#else
+    uint16_t       GetBufferDataSize(void) const { return kBufferDataSize; }
+    const uint8_t *GetBufferData(const Buffer &aBuffer) const { return aBuffer.GetData(); }
+    uint8_t       *GetBufferData(Buffer &aBuffer) { return aBuffer.GetData(); }
+#endif
 };
 
 /**
@@ -2043,7 +2126,37 @@ public:
      *
      * @sa GetMaxUsedBufferCount
      */
-    void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
+    void ResetMaxUsedBufferCount(void)
+    {
+        mMaxAllocated = mNumAllocated;
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+        mMaxLargeAllocated = mNumLargeAllocated;
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    /**
+     * Returns the number of free large buffers.
+     *
+     * @returns The number of free large buffers, or 0xffff (UINT16_MAX) if number is unknown.
+     */
+    uint16_t GetFreeLargeBufferCount(void) const;
+
+    /**
+     * Returns the total number of large buffers.
+     *
+     * @returns The total number of large buffers, or 0xffff (UINT16_MAX) if number is unknown.
+     */
+    uint16_t GetTotalLargeBufferCount(void) const;
+
+    /**
+     * Returns the maximum number of large buffers in use at the same time since OT stack initialization or
+     * since last call to `ResetMaxUsedBufferCount()`.
+     *
+     * @returns The maximum number of large buffers in use at the same time so far.
+     */
+    uint16_t GetMaxUsedLargeBufferCount(void) const { return mMaxLargeAllocated; }
+#endif
 
 private:
     static constexpr uint16_t kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
@@ -2052,11 +2165,25 @@ private:
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    static constexpr uint16_t kNumLargeBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS;
+
+    Buffer *NewLargeBuffer(Message::Priority aPriority);
+    void    FreeLargeBuffers(Buffer *aBuffer);
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    Pool<LargeBuffer, kNumLargeBuffers> mLargeBufferPool;
+#endif
 #endif
     uint16_t mNumAllocated;
     uint16_t mMaxAllocated;
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    uint16_t mNumLargeAllocated;
+    uint16_t mMaxLargeAllocated;
+#endif
 };
 
 // Declare specializations of `Message::Clone<CloneMode>()` (implemented in `message.cpp`).
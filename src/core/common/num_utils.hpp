@@ -292,6 +292,21 @@ template <typename IntType> inline constexpr IntType DivideAndRoundUp(IntType aD
     return (aDividend + (aDivisor - 1)) / aDivisor;
 }
 
+/**
+ * This template function rounds a number up to the nearest power of two.
+ *
+ * @tparam IntType   The unsigned integer type.
+ *
+ * @param[in] aValue   The value to round up.
+ * @param[in] aPower   A power of two to start from (used by the recursive implementation).
+ *
+ * @return The smallest power of two that is greater than or equal to @p aValue.
+ */
+template <typename IntType> inline constexpr IntType RoundUpToPowerOfTwo(IntType aValue, IntType aPower = 1)
+{
+    return (aPower >= aValue) ? aPower : RoundUpToPowerOfTwo<IntType>(aValue, static_cast<IntType>(aPower << 1));
+}
+
 /**
  * Casts a given `uint32_t` to `unsigned long`.
  *
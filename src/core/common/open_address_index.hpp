@@ -0,0 +1,267 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic open-addressing hash index.
+ */
+
+#ifndef OT_CORE_COMMON_OPEN_ADDRESS_INDEX_HPP_
+#define OT_CORE_COMMON_OPEN_ADDRESS_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+
+namespace ot {
+
+/**
+ * Calculates a 32-bit hash of a key, for use with `OpenAddressIndex`.
+ *
+ * The key is mixed in as a sequence of values using a multiplicative hash.
+ */
+class IndexHasher
+{
+public:
+    /**
+     * Initializes the `IndexHasher`.
+     *
+     * @param[in] aSeed  The initial hash value (e.g., a port number which is part of the key).
+     */
+    explicit IndexHasher(uint32_t aSeed = 0)
+        : mHash(aSeed)
+    {
+    }
+
+    /**
+     * Mixes a value into the hash.
+     *
+     * @param[in] aValue  The value to mix.
+     */
+    void Mix(uint32_t aValue) { mHash = (mHash ^ aValue) * kMultiplier; }
+
+    /**
+     * Mixes all the values of an array into the hash.
+     *
+     * @tparam ValueType  The array element type (an unsigned integer type).
+     * @tparam kLength    The array length.
+     *
+     * @param[in] aValues  The array of values to mix.
+     */
+    template <typename ValueType, uint16_t kLength> void Mix(const ValueType (&aValues)[kLength])
+    {
+        for (ValueType value : aValues)
+        {
+            Mix(value);
+        }
+    }
+
+    /**
+     * Gets the hash value.
+     *
+     * Only the upper bits of the value are well mixed.
+     *
+     * @returns The hash value.
+     */
+    uint32_t GetHash(void) const { return mHash; }
+
+    /**
+     * Gets the hash value with all its bits mixed.
+     *
+     * The multiplication only propagates key bits upwards, so keys which only differ in their upper bits (e.g., the
+     * last byte of an address read as a little-endian word) would otherwise collide in the low bits. The value is
+     * folded and remixed so that it can be used as `OpenAddressIndex::GetHomeSlot()` input.
+     *
+     * @returns The finalized hash value.
+     */
+    uint32_t GetFinalizedHash(void) const
+    {
+        uint32_t hash = mHash;
+
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6b;
+        hash ^= hash >> 13;
+
+        return hash;
+    }
+
+private:
+    static constexpr uint32_t kMultiplier = 0x9e3779b1;
+
+    uint32_t mHash;
+};
+
+/**
+ * Implements an open-addressing (linear probing) hash index over a table of entries.
+ *
+ * The index does not store the entries. Each slot holds the index of an entry in the table owned by the user (e.g.,
+ * a `Pool` or an `Array`), or `kNoEntry`. The index has at least twice as many slots as entries, so an empty slot is
+ * always found when adding and a lookup probe sequence stays short.
+ *
+ * Entries are removed using backward-shift deletion: any entry later in the probe sequence whose home slot is not
+ * cyclically within the freed slot and its current position is moved into the freed slot. This keeps every entry
+ * reachable from its home slot without tombstones.
+ *
+ * A lookup iterates over the slots starting from the home slot of the key until an empty slot:
+ *
+ *     for (uint16_t slot = Index::GetHomeSlot(hash); index.HasEntryAt(slot); slot = Index::GetNextSlot(slot))
+ *     {
+ *         Entry &entry = table[index.GetEntryAt(slot)];
+ *         ...
+ *     }
+ *
+ * @tparam kMaxEntries  The maximum number of entries in the index.
+ */
+template <uint16_t kMaxEntries> class OpenAddressIndex
+{
+public:
+    static constexpr uint16_t kNumSlots = RoundUpToPowerOfTwo<uint16_t>(2 * kMaxEntries); ///< Number of slots.
+    static constexpr uint16_t kNoEntry  = 0xffff; ///< Entry index of an empty slot.
+
+    static_assert(kMaxEntries < kNoEntry, "kMaxEntries is too large");
+
+    /**
+     * Gets the home slot for a given hash value.
+     *
+     * @param[in] aHash  The hash value (the low bits are used).
+     *
+     * @returns The home slot.
+     */
+    static uint16_t GetHomeSlot(uint32_t aHash) { return static_cast<uint16_t>(aHash & kSlotMask); }
+
+    /**
+     * Gets the next slot in a probe sequence.
+     *
+     * @param[in] aSlot  The current slot.
+     *
+     * @returns The next slot (wrapping around).
+     */
+    static uint16_t GetNextSlot(uint16_t aSlot) { return (aSlot + 1) & kSlotMask; }
+
+    /**
+     * Removes all entries from the index.
+     */
+    void Clear(void)
+    {
+        for (uint16_t &slot : mSlots)
+        {
+            slot = kNoEntry;
+        }
+    }
+
+    /**
+     * Indicates whether a slot holds an entry.
+     *
+     * @param[in] aSlot  The slot.
+     *
+     * @retval TRUE   The slot holds an entry.
+     * @retval FALSE  The slot is empty.
+     */
+    bool HasEntryAt(uint16_t aSlot) const { return mSlots[aSlot] != kNoEntry; }
+
+    /**
+     * Gets the entry index held in a slot.
+     *
+     * @param[in] aSlot  The slot.
+     *
+     * @returns The entry index, or `kNoEntry` if the slot is empty.
+     */
+    uint16_t GetEntryAt(uint16_t aSlot) const { return mSlots[aSlot]; }
+
+    /**
+     * Adds an entry to the index.
+     *
+     * The index MUST hold fewer than `kMaxEntries` entries.
+     *
+     * @param[in] aEntryIndex  The entry index.
+     * @param[in] aHomeSlot    The home slot of the entry key.
+     */
+    void Add(uint16_t aEntryIndex, uint16_t aHomeSlot)
+    {
+        uint16_t slot = aHomeSlot;
+
+        while (HasEntryAt(slot))
+        {
+            slot = GetNextSlot(slot);
+        }
+
+        mSlots[slot] = aEntryIndex;
+    }
+
+    /**
+     * Removes an entry from the index.
+     *
+     * The other entries in the probe sequence may be moved, so the home slot of any entry must be determined by
+     * @p aHomeSlotGetter, which provides the following method:
+     *
+     *     uint16_t GetHomeSlot(uint16_t aEntryIndex) const;
+     *
+     * @tparam HomeSlotGetter  The type which determines the home slot of an entry.
+     *
+     * @param[in] aEntryIndex      The entry index. No action is taken if it is not in the index.
+     * @param[in] aHomeSlotGetter  Determines the home slot of an entry in the index.
+     */
+    template <typename HomeSlotGetter> void Remove(uint16_t aEntryIndex, const HomeSlotGetter &aHomeSlotGetter)
+    {
+        uint16_t slot = aHomeSlotGetter.GetHomeSlot(aEntryIndex);
+
+        while (mSlots[slot] != aEntryIndex)
+        {
+            VerifyOrExit(HasEntryAt(slot));
+            slot = GetNextSlot(slot);
+        }
+
+        for (uint16_t next = GetNextSlot(slot); HasEntryAt(next); next = GetNextSlot(next))
+        {
+            uint16_t home = aHomeSlotGetter.GetHomeSlot(mSlots[next]);
+
+            if (((next - home) & kSlotMask) >= ((next - slot) & kSlotMask))
+            {
+                mSlots[slot] = mSlots[next];
+                slot         = next;
+            }
+        }
+
+        mSlots[slot] = kNoEntry;
+
+    exit:
+        return;
+    }
+
+private:
+    static constexpr uint16_t kSlotMask = kNumSlots - 1;
+
+    uint16_t mSlots[kNumSlots];
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_OPEN_ADDRESS_INDEX_HPP_
@@ -152,6 +152,182 @@ void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().Rem
 //---------------------------------------------------------------------------------------------------------------------
 // `Timer::Scheduler`
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mNext  = nullptr;
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+
+    mHeapRoot = Meld(mHeapRoot, &aTimer, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    if (mHeapRoot == &aTimer)
+    {
+        mHeapRoot = MergePairs(aTimer.mChild, Time(aAlarmApi.AlarmGetNow()));
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        Time now(aAlarmApi.AlarmGetNow());
+
+        // Detach the timer from its parent (if it is the first child)
+        // or from its previous sibling, then meld the sub-heaps formed
+        // by its children back into the heap.
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        mHeapRoot = Meld(mHeapRoot, MergePairs(aTimer.mChild, now), now);
+    }
+
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+    aTimer.SetNext(&aTimer);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer = mHeapRoot;
+
+    // Visit all timers in the heap and mark them as not running. The
+    // children of a visited timer are spliced in front of its
+    // remaining siblings so that every timer is visited once.
+
+    while (timer != nullptr)
+    {
+        Timer *next = timer->mNext;
+
+        if (timer->mChild != nullptr)
+        {
+            Timer *last = timer->mChild;
+
+            while (last->mNext != nullptr)
+            {
+                last = last->mNext;
+            }
+
+            last->mNext = next;
+            next        = timer->mChild;
+        }
+
+        timer->mChild = nullptr;
+        timer->mPrev  = nullptr;
+        timer->SetNext(timer);
+
+        timer = next;
+    }
+
+    mHeapRoot = nullptr;
+
+    SetAlarm(aAlarmApi);
+}
+
+Timer *Timer::Scheduler::Meld(Timer *aFirst, Timer *aSecond, Time aNow)
+{
+    // Melds two heaps (given their roots) and returns the root of the
+    // combined heap. The root firing later becomes the first child of
+    // the other one. On a tie, `aFirst` remains the root.
+
+    Timer *root  = aFirst;
+    Timer *child = aSecond;
+
+    if (root == nullptr)
+    {
+        root  = aSecond;
+        child = nullptr;
+    }
+    else if ((child != nullptr) && child->DoesFireBefore(*root, aNow))
+    {
+        root  = aSecond;
+        child = aFirst;
+    }
+
+    VerifyOrExit(root != nullptr);
+
+    if (child != nullptr)
+    {
+        child->mPrev = root;
+        child->mNext = root->mChild;
+
+        if (root->mChild != nullptr)
+        {
+            root->mChild->mPrev = child;
+        }
+
+        root->mChild = child;
+    }
+
+    root->mNext = nullptr;
+    root->mPrev = nullptr;
+
+exit:
+    return root;
+}
+
+Timer *Timer::Scheduler::MergePairs(Timer *aFirst, Time aNow)
+{
+    // Melds a list of sibling sub-heaps (linked through `mNext`) into
+    // a single heap using the two-pass pairing method. The first pass
+    // melds the siblings in pairs from left to right, pushing each
+    // result on a stack (also linked through `mNext`). The second pass
+    // pops the stack, melding the pairs from right to left.
+
+    Timer *stack = nullptr;
+    Timer *root  = nullptr;
+
+    while (aFirst != nullptr)
+    {
+        Timer *second = aFirst->mNext;
+        Timer *next   = (second != nullptr) ? second->mNext : nullptr;
+        Timer *pair   = Meld(aFirst, second, aNow);
+
+        pair->mNext = stack;
+        stack       = pair;
+        aFirst      = next;
+    }
+
+    while (stack != nullptr)
+    {
+        Timer *next = stack->mNext;
+
+        root  = Meld(root, stack, aNow);
+        stack = next;
+    }
+
+    return root;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -200,9 +376,23 @@ exit:
     return;
 }
 
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+
 void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    if (GetHead() == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
@@ -211,7 +401,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
-        remaining = mTimerList.GetHead()->mFireTime.DetermineRemainingDurationFrom(now);
+        remaining = GetHead()->mFireTime.DetermineRemainingDurationFrom(now);
 
         aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
     }
@@ -219,7 +409,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -239,18 +429,6 @@ exit:
     return;
 }
 
-void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
-{
-    Timer *timer;
-
-    while ((timer = mTimerList.Pop()) != nullptr)
-    {
-        timer->SetNext(timer);
-    }
-
-    SetAlarm(aAlarmApi);
-}
-
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
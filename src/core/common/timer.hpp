@@ -224,6 +224,9 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+            , mHeapRoot(nullptr)
+#endif
         {
         }
 
@@ -233,13 +236,34 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+        // The running timers are kept in a pairing heap. Each timer
+        // tracks its first child (`mChild`), its next sibling
+        // (`mNext`) and its previous node (`mPrev`) which is the
+        // parent for the first child or the previous sibling
+        // otherwise. The heap root has no sibling or previous node.
+
+        Timer *GetHead(void) { return mHeapRoot; }
+
+        static Timer *Meld(Timer *aFirst, Timer *aSecond, Time aNow);
+        static Timer *MergePairs(Timer *aFirst, Time aNow);
+
+        Timer *mHeapRoot;
+#else
+        Timer *GetHead(void) { return mTimerList.GetHead(); }
+
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+#endif
     {
     }
 
@@ -249,6 +273,10 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+    Timer *mChild;
+    Timer *mPrev;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -54,6 +54,49 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_BYTES
+ *
+ * Maximum total size (in bytes) of cached responses for CoAP Confirmable messages.
+ *
+ * When adding a new response would exceed either this limit or `OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES`,
+ * the cached responses with the earliest expiration time are removed first. A response larger than this limit is not
+ * cached.
+ *
+ * Zero (default) only limits the number of cached responses. With a byte limit, large responses can evict cached
+ * entries before their exchange lifetime ends, so a retransmitted request may be handled again.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_BYTES
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_BYTES 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+ *
+ * Define to 1 to index CoAP pending requests.
+ *
+ * When enabled, pending requests are indexed by their token and message ID so that a received response is matched
+ * without scanning all pending requests, and their retransmission timeouts are kept in a min-heap so that handling the
+ * retransmission timer does not visit the requests which are not yet due.
+ *
+ * If the index is full (see `OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE`), new requests are still sent and
+ * tracked but are matched and retransmitted by scanning the pending requests, as when the index is disabled.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+ *
+ * Maximum number of pending requests tracked by the index (per CoAP instance).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
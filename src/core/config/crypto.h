@@ -81,6 +81,23 @@
 #define OPENTHREAD_CONFIG_CRYPTO_PLATFORM_CCM_ONE_SHOT_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+ *
+ * Define to 1 to enable AES-CCM acceleration using CPU AES instructions.
+ *
+ * When enabled and the CPU supports them (AES-NI on x86, or the ARMv8
+ * Cryptography Extension on AArch64 when targeted by the build), the
+ * built-in AES-CCM engine uses them for literal AES-128 keys and
+ * processes the whole payload blocks in a single call. Otherwise, it
+ * falls back to the `otPlatCryptoAes*` APIs. This is intended for
+ * hosts (e.g., Linux Border Routers) performing MAC security in
+ * software.
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+#define OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE 0
+#endif
+
 #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
 
 /**
@@ -114,6 +114,19 @@
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_PERSIST_STATE_ON_POST_PROBE_CONFLICT 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used to index registered host and service entries by name.
+ *
+ * The index is used to look up the entry matching a question or a record name in a received mDNS message, avoiding a
+ * linear scan over all registered entries. Larger values reduce the chain length per bucket at the cost of RAM (one
+ * pointer per bucket, for each of host and service entries).
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_INDEX_SIZE
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_INDEX_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MULTICAST_DNS_VERBOSE_LOGGING_ENABLE
  *
@@ -217,6 +217,47 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+ *
+ * Define as 1 to add a second class of (large) message buffers to the message pool.
+ *
+ * The first buffer of every message is a regular buffer (holding the message metadata). When a message is grown to a
+ * size which would need more than two regular buffers and no buffer is chained after its first one, the remaining
+ * buffers of the message are allocated from the large buffer class (if any is available). This reduces the number of
+ * buffers in the chain for large messages (e.g., IPv6 packets close to the MTU), and so the cost of reading, writing
+ * or computing a checksum over them.
+ *
+ * Large buffers are not supported with `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT`.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+ *
+ * The number of large message buffers in the buffer pool.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE` is set.
+ *
+ * @note If `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE` is set, this is ignored.
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+ *
+ * The size of a large message buffer in bytes.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE` is set.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE 1280
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -285,7 +326,8 @@
  */
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-// Internal heap doesn't support size larger than 64K bytes.
+// Internal heap doesn't support size larger than 64K bytes (unless
+// `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE` is used).
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (63 * 1024)
 #elif OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (3136 * sizeof(void *))
@@ -301,7 +343,8 @@
  */
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-// Internal heap doesn't support size larger than 64K bytes.
+// Internal heap doesn't support size larger than 64K bytes (unless
+// `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE` is used).
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS (63 * 1024)
 #elif OPENTHREAD_CONFIG_ECDSA_ENABLE
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS 2600
@@ -310,6 +353,100 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+ *
+ * Define as 1 to use a segregated-fit allocator for the internal heap.
+ *
+ * The heap is divided into 512-byte pages. Small allocations (up to 256 bytes) are served from pages dedicated to
+ * a size class in O(1), and larger ones use runs of whole pages. Block sizes are 32-bit, so the heap size can exceed
+ * 64 KiB. The allocator is intended for hosts (e.g., border routers) with a large heap, and the size class statistics
+ * are available through `otHeapGetSizeClassInfo()`.
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+ *
+ * Define as 1 to have the timer schedulers (`TimerMilli` and `TimerMicro`) keep the running timers in a pairing heap
+ * instead of a sorted linked list.
+ *
+ * With the heap, starting a timer is O(1) and stopping a timer or firing the earliest one is O(log n) amortized, where
+ * n is the number of running timers. This is intended for devices with a large number of running timers (e.g., Border
+ * Routers). It adds two pointers to every `Timer` object. Timers with the same fire time are not guaranteed to fire in
+ * the order they were started.
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_HEAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+ *
+ * Define as 1 to have `KeyManager` cache the MLE and TREL keys derived for the key sequences adjacent to the current
+ * one (current - 1 and current + 1).
+ *
+ * The cached keys are refreshed whenever the key sequence changes. Frames secured with an adjacent key sequence (e.g.,
+ * received around a key rotation) then use a cached key instead of recomputing HMAC-SHA256 over the Network Key. The
+ * cache hit and miss counters are available through `otThreadGetKeyCacheCounters()`.
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+ *
+ * Define as 1 to have the Leader Network Data keep a table of the 6LoWPAN contexts it contains.
+ *
+ * The table is rebuilt whenever the Network Data changes and is used by `FindContextForAddress()` and
+ * `FindContextForId()` (e.g., for every frame compressed or decompressed by `Lowpan`) instead of parsing the Network
+ * Data TLVs on each call.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+ *
+ * Define as 1 to have the Leader Network Data keep a compiled forwarding table of the prefixes it contains.
+ *
+ * The table is a longest-prefix-match trie over the Prefix TLVs, with the route and border router entries of each
+ * prefix reduced to those with the highest preference. It is rebuilt whenever the Network Data changes and is used by
+ * `IsOnMesh()` and `RouteLookup()` (e.g., for every forwarded IPv6 packet) instead of parsing the Network Data TLVs on
+ * each call. Path costs are still evaluated on each lookup, so router table changes do not require a rebuild.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_PREFIXES
+ *
+ * The maximum number of Prefix TLVs in the route cache (MUST be less than 128). If the Network Data contains more, the
+ * lookups search the Network Data TLVs.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_PREFIXES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_ENTRIES
+ *
+ * The maximum number of route and border router entries in the route cache (MUST be less than 256). If more are
+ * needed, the lookups search the Network Data TLVs.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_ENTRIES 48
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESHCOP_STEERING_DATA_API_ENABLE
  *
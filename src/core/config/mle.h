@@ -82,6 +82,20 @@
 #define OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define as 1 to maintain lookup indexes in the child table, so that searching for a child by RLOC16 or Extended
+ * Address does not iterate over all child entries, and checking whether a child has registered an IPv6 address skips
+ * most children without comparing addresses.
+ *
+ * The indexes use about four bytes of RAM per child table entry plus four bytes per child for the address filter. By
+ * default they are enabled when `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN` is larger than 32.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE (OPENTHREAD_CONFIG_MLE_MAX_CHILDREN > 32)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_DEVICE_PROPERTY_LEADER_WEIGHT_ENABLE
  *
@@ -138,6 +138,62 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used by SRP server to index registered hosts (by host name) and services (by
+ * service instance name and by service name).
+ *
+ * The indices are used when processing an SRP update (e.g., name conflict checks) and by the DNS-SD server when
+ * resolving queries using SRP server entries, avoiding a linear scan over all registered hosts and services. Larger
+ * values reduce the chain length per bucket at the cost of RAM (one pointer per bucket for each of the three indices).
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+ *
+ * Define to 1 to enable SRP server update queue.
+ *
+ * When enabled, an SRP update message received directly from a client is not processed from the UDP receive
+ * callback. Instead, a copy of the message is queued and the queued messages are processed (parsed, signature
+ * verified, and committed) in the order they were received, one message per tasklet run. This avoids back-to-back
+ * signature verifications from stalling other tasks when many clients register at the same time (e.g., after a Border
+ * Router restart). A retransmission of an update which is already queued is dropped.
+ *
+ * If the queue is full (see `OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH`) or the message cannot be copied,
+ * the update is dropped (the client retransmits it), so that it is never committed ahead of older queued updates.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH
+ *
+ * Specifies the maximum number of SRP update messages in the SRP server update queue.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH
+#define OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE
+ *
+ * Specifies the number of entries in the SRP server verified signature cache.
+ *
+ * The cache remembers recently verified SIG(0) signatures (along with the host key and the hash of the signed data) so
+ * that a retransmitted SRP update (e.g., when the response to the client was lost) is not verified again. Set to zero
+ * to disable the cache.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE 4
+#endif
+
 /**
  * @}
  */
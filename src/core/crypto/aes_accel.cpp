@@ -0,0 +1,362 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements AES computations using CPU AES instructions.
+ */
+
+#include "aes_accel.hpp"
+
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OT_AES_ACCEL_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN) && \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define OT_AES_ACCEL_ARM 1
+#include <arm_neon.h>
+#endif
+
+namespace ot {
+namespace Crypto {
+
+AesAccel::SupportState AesAccel::sSupportState = kSupportUnknown;
+
+bool AesAccel::IsSupported(void)
+{
+    if (sSupportState == kSupportUnknown)
+    {
+        sSupportState = DetectSupport() ? kSupported : kNotSupported;
+    }
+
+    return (sSupportState == kSupported);
+}
+
+AesAccel::~AesAccel(void) { memset(mRoundKeys, 0, sizeof(mRoundKeys)); }
+
+#if OT_AES_ACCEL_X86 || OT_AES_ACCEL_ARM
+
+namespace {
+
+// The round functions are compiled for the AES instructions via
+// the `target` attribute (x86) so that the rest of the core does
+// not need to be built with `-maes`. They are only called after
+// `AesAccel::IsSupported()` has confirmed the CPU support.
+
+#if OT_AES_ACCEL_X86
+
+#define OT_AES_ACCEL_TARGET __attribute__((target("aes,sse2")))
+
+typedef __m128i Block;
+
+OT_AES_ACCEL_TARGET inline Block LoadBlock(const void *aBytes)
+{
+    return _mm_loadu_si128(static_cast<const __m128i *>(aBytes));
+}
+
+OT_AES_ACCEL_TARGET inline void StoreBlock(void *aBytes, Block aBlock)
+{
+    _mm_storeu_si128(static_cast<__m128i *>(aBytes), aBlock);
+}
+
+OT_AES_ACCEL_TARGET inline Block XorBlocks(Block aFirst, Block aSecond) { return _mm_xor_si128(aFirst, aSecond); }
+
+OT_AES_ACCEL_TARGET inline Block EncryptRounds(Block aState, const Block *aRoundKeys)
+{
+    aState = _mm_xor_si128(aState, aRoundKeys[0]);
+
+    for (uint8_t round = 1; round < 10; round++)
+    {
+        aState = _mm_aesenc_si128(aState, aRoundKeys[round]);
+    }
+
+    return _mm_aesenclast_si128(aState, aRoundKeys[10]);
+}
+
+OT_AES_ACCEL_TARGET inline void EncryptRounds2(Block &aFirst, Block &aSecond, const Block *aRoundKeys)
+{
+    aFirst  = _mm_xor_si128(aFirst, aRoundKeys[0]);
+    aSecond = _mm_xor_si128(aSecond, aRoundKeys[0]);
+
+    for (uint8_t round = 1; round < 10; round++)
+    {
+        aFirst  = _mm_aesenc_si128(aFirst, aRoundKeys[round]);
+        aSecond = _mm_aesenc_si128(aSecond, aRoundKeys[round]);
+    }
+
+    aFirst  = _mm_aesenclast_si128(aFirst, aRoundKeys[10]);
+    aSecond = _mm_aesenclast_si128(aSecond, aRoundKeys[10]);
+}
+
+OT_AES_ACCEL_TARGET inline uint32_t SubWord(uint32_t aWord)
+{
+    // With all four columns of the state equal to `aWord`, ShiftRows
+    // has no effect and `aesenclast` with a zero round key yields
+    // SubBytes of each column.
+
+    Block state = _mm_set1_epi32(static_cast<int>(aWord));
+
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_aesenclast_si128(state, _mm_setzero_si128())));
+}
+
+#elif OT_AES_ACCEL_ARM
+
+#define OT_AES_ACCEL_TARGET
+
+typedef uint8x16_t Block;
+
+inline Block LoadBlock(const void *aBytes) { return vld1q_u8(static_cast<const uint8_t *>(aBytes)); }
+
+inline void StoreBlock(void *aBytes, Block aBlock) { vst1q_u8(static_cast<uint8_t *>(aBytes), aBlock); }
+
+inline Block XorBlocks(Block aFirst, Block aSecond) { return veorq_u8(aFirst, aSecond); }
+
+inline Block EncryptRounds(Block aState, const Block *aRoundKeys)
+{
+    for (uint8_t round = 0; round < 9; round++)
+    {
+        aState = vaesmcq_u8(vaeseq_u8(aState, aRoundKeys[round]));
+    }
+
+    return veorq_u8(vaeseq_u8(aState, aRoundKeys[9]), aRoundKeys[10]);
+}
+
+inline void EncryptRounds2(Block &aFirst, Block &aSecond, const Block *aRoundKeys)
+{
+    for (uint8_t round = 0; round < 9; round++)
+    {
+        aFirst  = vaesmcq_u8(vaeseq_u8(aFirst, aRoundKeys[round]));
+        aSecond = vaesmcq_u8(vaeseq_u8(aSecond, aRoundKeys[round]));
+    }
+
+    aFirst  = veorq_u8(vaeseq_u8(aFirst, aRoundKeys[9]), aRoundKeys[10]);
+    aSecond = veorq_u8(vaeseq_u8(aSecond, aRoundKeys[9]), aRoundKeys[10]);
+}
+
+inline uint32_t SubWord(uint32_t aWord)
+{
+    // With all four columns of the state equal to `aWord`, ShiftRows
+    // has no effect and `aese` with a zero round key yields SubBytes
+    // of each column.
+
+    Block state = vreinterpretq_u8_u32(vdupq_n_u32(aWord));
+
+    return vgetq_lane_u32(vreinterpretq_u32_u8(vaeseq_u8(state, vdupq_n_u8(0))), 0);
+}
+
+#endif // OT_AES_ACCEL_ARM
+
+OT_AES_ACCEL_TARGET inline void IncrementCounter(uint8_t *aCounter, uint8_t aCounterOffset)
+{
+    for (uint8_t index = AesAccel::kBlockSize - 1; index >= aCounterOffset; index--)
+    {
+        if (++aCounter[index] != 0)
+        {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+bool AesAccel::DetectSupport(void)
+{
+#if OT_AES_ACCEL_X86
+    unsigned int eax, ebx, ecx, edx;
+
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES) && (edx & bit_SSE2);
+#else
+    // The build targets the ARMv8 Cryptography Extension.
+    return true;
+#endif
+}
+
+OT_AES_ACCEL_TARGET void AesAccel::SetKey(const uint8_t aKey[kKeySize])
+{
+    // AES-128 key expansion (FIPS-197 section 5.2). The words are
+    // kept in host (little-endian) byte order, so `RotWord()` is a
+    // right rotation by 8 bits and the round constant is applied
+    // to the least significant byte.
+
+    static const uint8_t kRoundConstants[kNumRounds] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
+
+    OT_ASSERT(IsSupported());
+
+    memcpy(mRoundKeys, aKey, kKeySize);
+
+    for (uint8_t index = kNumKeyWords; index < kNumRoundKeys * kNumKeyWords; index++)
+    {
+        uint32_t word = mRoundKeys[index - 1];
+
+        if ((index % kNumKeyWords) == 0)
+        {
+            word = SubWord((word >> 8) | (word << 24)) ^ kRoundConstants[index / kNumKeyWords - 1];
+        }
+
+        mRoundKeys[index] = mRoundKeys[index - kNumKeyWords] ^ word;
+    }
+}
+
+OT_AES_ACCEL_TARGET void AesAccel::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const
+{
+    Block roundKeys[kNumRoundKeys];
+
+    for (uint8_t round = 0; round < kNumRoundKeys; round++)
+    {
+        roundKeys[round] = LoadBlock(&mRoundKeys[round * kNumKeyWords]);
+    }
+
+    StoreBlock(aOutput, EncryptRounds(LoadBlock(aInput), roundKeys));
+}
+
+OT_AES_ACCEL_TARGET void AesAccel::ProcessCcmBlocks(bool           aEncrypt,
+                                                    const uint8_t *aInput,
+                                                    uint8_t       *aOutput,
+                                                    uint32_t       aNumBlocks,
+                                                    uint8_t        aMacBlock[kBlockSize],
+                                                    uint8_t        aCounter[kBlockSize],
+                                                    uint8_t        aCounterOffset) const
+{
+    Block roundKeys[kNumRoundKeys];
+    Block mac;
+    Block pad;
+    Block data;
+
+    OT_ASSERT(aCounterOffset > 0);
+
+    VerifyOrExit(aNumBlocks > 0);
+
+    for (uint8_t round = 0; round < kNumRoundKeys; round++)
+    {
+        roundKeys[round] = LoadBlock(&mRoundKeys[round * kNumKeyWords]);
+    }
+
+    mac = LoadBlock(aMacBlock);
+
+    if (aEncrypt)
+    {
+        // The CBC-MAC of a block and its key stream are independent,
+        // so both are encrypted together.
+
+        for (; aNumBlocks > 0; aNumBlocks--)
+        {
+            IncrementCounter(aCounter, aCounterOffset);
+            pad  = LoadBlock(aCounter);
+            data = LoadBlock(aInput);
+            mac  = XorBlocks(mac, data);
+
+            EncryptRounds2(mac, pad, roundKeys);
+            StoreBlock(aOutput, XorBlocks(data, pad));
+
+            aInput += kBlockSize;
+            aOutput += kBlockSize;
+        }
+    }
+    else
+    {
+        // The CBC-MAC needs the decrypted block, so the key stream
+        // of the next block is generated along with the CBC-MAC of
+        // the current one.
+
+        IncrementCounter(aCounter, aCounterOffset);
+        pad = EncryptRounds(LoadBlock(aCounter), roundKeys);
+
+        for (; aNumBlocks > 1; aNumBlocks--)
+        {
+            data = XorBlocks(LoadBlock(aInput), pad);
+            StoreBlock(aOutput, data);
+            mac = XorBlocks(mac, data);
+
+            IncrementCounter(aCounter, aCounterOffset);
+            pad = LoadBlock(aCounter);
+            EncryptRounds2(mac, pad, roundKeys);
+
+            aInput += kBlockSize;
+            aOutput += kBlockSize;
+        }
+
+        data = XorBlocks(LoadBlock(aInput), pad);
+        StoreBlock(aOutput, data);
+        mac = EncryptRounds(XorBlocks(mac, data), roundKeys);
+    }
+
+    StoreBlock(aMacBlock, mac);
+
+exit:
+    return;
+}
+
+#else // OT_AES_ACCEL_X86 || OT_AES_ACCEL_ARM
+
+bool AesAccel::DetectSupport(void) { return false; }
+
+void AesAccel::SetKey(const uint8_t aKey[kKeySize])
+{
+    OT_UNUSED_VARIABLE(aKey);
+    OT_ASSERT(false);
+}
+
+void AesAccel::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const
+{
+    OT_UNUSED_VARIABLE(aInput);
+    OT_UNUSED_VARIABLE(aOutput);
+    OT_ASSERT(false);
+}
+
+void AesAccel::ProcessCcmBlocks(bool           aEncrypt,
+                                const uint8_t *aInput,
+                                uint8_t       *aOutput,
+                                uint32_t       aNumBlocks,
+                                uint8_t        aMacBlock[kBlockSize],
+                                uint8_t        aCounter[kBlockSize],
+                                uint8_t        aCounterOffset) const
+{
+    OT_UNUSED_VARIABLE(aEncrypt);
+    OT_UNUSED_VARIABLE(aInput);
+    OT_UNUSED_VARIABLE(aOutput);
+    OT_UNUSED_VARIABLE(aNumBlocks);
+    OT_UNUSED_VARIABLE(aMacBlock);
+    OT_UNUSED_VARIABLE(aCounter);
+    OT_UNUSED_VARIABLE(aCounterOffset);
+    OT_ASSERT(false);
+}
+
+#endif // OT_AES_ACCEL_X86 || OT_AES_ACCEL_ARM
+
+} // namespace Crypto
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
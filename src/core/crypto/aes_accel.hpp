@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for AES computations using CPU AES instructions.
+ */
+
+#ifndef OT_CORE_CRYPTO_AES_ACCEL_HPP_
+#define OT_CORE_CRYPTO_AES_ACCEL_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+
+#include <stdint.h>
+
+#include "crypto/aes_ecb.hpp"
+
+namespace ot {
+
+class UnitTester;
+
+namespace Crypto {
+
+/**
+ * @addtogroup core-security
+ *
+ * @{
+ */
+
+/**
+ * Implements AES-128 encryption using CPU AES instructions.
+ *
+ * AES-NI is used on x86 when the CPU supports it (detected at run-time). The ARMv8 Cryptography Extension is used on
+ * AArch64 when the build targets it (e.g., `-march=armv8-a+crypto`). Callers MUST check `IsSupported()` and fall
+ * back to `AesEcb` when it returns `false`.
+ */
+class AesAccel
+{
+    friend class ot::UnitTester;
+
+public:
+    static constexpr uint8_t kBlockSize = AesEcb::kBlockSize; ///< AES block size (bytes).
+    static constexpr uint8_t kKeySize   = 16;                 ///< AES-128 key size (bytes).
+
+    /**
+     * Indicates whether or not the CPU AES instructions are available.
+     *
+     * @retval TRUE   The `AesAccel` can be used.
+     * @retval FALSE  The `AesAccel` cannot be used.
+     */
+    static bool IsSupported(void);
+
+    /**
+     * Clears the expanded key.
+     */
+    ~AesAccel(void);
+
+    /**
+     * Sets the key and expands it into the round keys.
+     *
+     * MUST be called only when `IsSupported()` returns `true`.
+     *
+     * @param[in]  aKey  The AES-128 key.
+     */
+    void SetKey(const uint8_t aKey[kKeySize]);
+
+    /**
+     * Encrypts a single block.
+     *
+     * @param[in]   aInput   A pointer to the input block.
+     * @param[out]  aOutput  A pointer to the output block.
+     */
+    void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const;
+
+    /**
+     * Performs the AES-CCM CTR encryption/decryption and CBC-MAC computation over a number of whole payload blocks.
+     *
+     * The AES operations of the CTR and CBC-MAC passes are interleaved. Before each block, the counter field of
+     * @p aCounter (from @p aCounterOffset to the end of the block) is incremented and used to generate the key stream.
+     * The CBC-MAC in @p aMacBlock is computed over the plaintext (i.e., @p aInput when encrypting and @p aOutput when
+     * decrypting). @p aInput and @p aOutput can point to the same buffer.
+     *
+     * @param[in]     aEncrypt        TRUE to encrypt, FALSE to decrypt.
+     * @param[in]     aInput          A pointer to the input blocks.
+     * @param[out]    aOutput         A pointer to a buffer to output the blocks.
+     * @param[in]     aNumBlocks      The number of blocks to process.
+     * @param[in,out] aMacBlock       The CBC-MAC block (already encrypted with all previous blocks).
+     * @param[in,out] aCounter        The counter block (holding the last used counter value).
+     * @param[in]     aCounterOffset  The index of the first byte of the counter field in @p aCounter.
+     */
+    void ProcessCcmBlocks(bool           aEncrypt,
+                          const uint8_t *aInput,
+                          uint8_t       *aOutput,
+                          uint32_t       aNumBlocks,
+                          uint8_t        aMacBlock[kBlockSize],
+                          uint8_t        aCounter[kBlockSize],
+                          uint8_t        aCounterOffset) const;
+
+private:
+    static constexpr uint8_t kNumRounds    = 10;
+    static constexpr uint8_t kNumKeyWords  = kKeySize / sizeof(uint32_t);
+    static constexpr uint8_t kNumRoundKeys = kNumRounds + 1;
+
+    enum SupportState : uint8_t
+    {
+        kSupportUnknown,
+        kSupported,
+        kNotSupported,
+    };
+
+    static bool DetectSupport(void);
+
+    static SupportState sSupportState;
+
+    uint32_t mRoundKeys[kNumRoundKeys * kNumKeyWords];
+};
+
+/**
+ * @}
+ */
+
+} // namespace Crypto
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+
+#endif // OT_CORE_CRYPTO_AES_ACCEL_HPP_
@@ -246,7 +246,19 @@ void AesCcm::Engine::Start(const Config &aConfig)
 
     OT_ASSERT(aConfig.IsValid());
 
-    mEcb.SetKey(aConfig.GetKey());
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+    mUseAccel = (aConfig.GetKey().GetBytes() != nullptr) && (aConfig.GetKey().GetLength() == AesAccel::kKeySize) &&
+                AesAccel::IsSupported();
+
+    if (mUseAccel)
+    {
+        mAccel.SetKey(aConfig.GetKey().GetBytes());
+    }
+    else
+#endif
+    {
+        mEcb.SetKey(aConfig.GetKey());
+    }
 
     mNonceLength     = aConfig.mNonceLength;
     mTagLength       = aConfig.mTagLength;
@@ -301,7 +313,7 @@ void AesCcm::Engine::Start(const Config &aConfig)
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    EncryptBlock(mBlock, mBlock);
 
     // process header
     if (mHeaderLength > 0)
@@ -346,7 +358,7 @@ void AesCcm::Engine::AddHeader(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            EncryptBlock(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -360,7 +372,7 @@ void AesCcm::Engine::AddHeader(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            EncryptBlock(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -375,6 +387,39 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+    // When the key stream is fully used and the CBC-MAC block is
+    // block-aligned, the whole payload blocks are processed in one
+    // call and the remaining bytes by the loop below.
+
+    if (mUseAccel && (mCtrLength == sizeof(mCtrPad)) && ((mBlockLength % sizeof(mBlock)) == 0) &&
+        (plaintextBytes != nullptr) && (ciphertextBytes != nullptr) && (aLength >= sizeof(mBlock)))
+    {
+        uint32_t numBlocks = aLength / sizeof(mBlock);
+        uint32_t length    = numBlocks * sizeof(mBlock);
+
+        if (mBlockLength != 0)
+        {
+            EncryptBlock(mBlock, mBlock);
+            mBlockLength = 0;
+        }
+
+        if (aOperation == kEncrypt)
+        {
+            mAccel.ProcessCcmBlocks(true, plaintextBytes, ciphertextBytes, numBlocks, mBlock, mCtr, mNonceLength + 1);
+        }
+        else
+        {
+            mAccel.ProcessCcmBlocks(false, ciphertextBytes, plaintextBytes, numBlocks, mBlock, mCtr, mNonceLength + 1);
+        }
+
+        plaintextBytes += length;
+        ciphertextBytes += length;
+        aLength -= length;
+        mPlainTextCur += length;
+    }
+#endif
+
     for (unsigned i = 0; i < aLength; i++)
     {
         if (mCtrLength == 16)
@@ -387,7 +432,7 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            EncryptBlock(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -412,7 +457,7 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            EncryptBlock(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -425,7 +470,7 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            EncryptBlock(mBlock, mBlock);
         }
 
         // reset counter
@@ -433,13 +478,27 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
     }
 }
 
+void AesCcm::Engine::EncryptBlock(const uint8_t aInput[AesEcb::kBlockSize], uint8_t aOutput[AesEcb::kBlockSize])
+{
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+    if (mUseAccel)
+    {
+        mAccel.Encrypt(aInput, aOutput);
+    }
+    else
+#endif
+    {
+        mEcb.Encrypt(aInput, aOutput);
+    }
+}
+
 void AesCcm::Engine::Finalize(void *aTag)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    EncryptBlock(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -42,6 +42,7 @@
 #include "common/error.hpp"
 #include "common/message.hpp"
 #include "common/type_traits.hpp"
+#include "crypto/aes_accel.hpp"
 #include "crypto/aes_ecb.hpp"
 #include "crypto/storage.hpp"
 #include "mac/mac_types.hpp"
@@ -266,7 +267,13 @@ private:
         void Finalize(void *aTag);
 
     private:
+        void EncryptBlock(const uint8_t aInput[AesEcb::kBlockSize], uint8_t aOutput[AesEcb::kBlockSize]);
+
         AesEcb   mEcb;
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+        AesAccel mAccel;
+        bool     mUseAccel;
+#endif
         uint8_t  mBlock[AesEcb::kBlockSize];
         uint8_t  mCtr[AesEcb::kBlockSize];
         uint8_t  mCtrPad[AesEcb::kBlockSize];
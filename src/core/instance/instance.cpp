@@ -565,6 +565,12 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mFreeBuffers    = Get<MessagePool>().GetFreeBufferCount();
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    aInfo.mTotalLargeBuffers   = Get<MessagePool>().GetTotalLargeBufferCount();
+    aInfo.mFreeLargeBuffers    = Get<MessagePool>().GetFreeLargeBufferCount();
+    aInfo.mMaxUsedLargeBuffers = Get<MessagePool>().GetMaxUsedLargeBufferCount();
+#endif
+
     Get<MeshForwarder>().GetQueueInfo(aInfo.m6loSendQueue, aInfo.m6loReassemblyQueue);
     Get<Ip6::Ip6>().GetSendQueueInfo(aInfo.mIp6Queue);
 
@@ -33,6 +33,8 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/log.hpp"
 #include "common/message.hpp"
@@ -74,13 +76,67 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // One's complement sum is independent of byte order (RFC 1071),
+    // so the bulk of the data is summed as native-endian 32-bit words
+    // into a 64-bit accumulator which cannot overflow for a `uint16_t`
+    // length. The folded result is then converted to big-endian and
+    // added to `mValue`. A leading byte (when the previous chunk ended
+    // on an odd index) and a trailing odd byte are added individually
+    // so that chunks can be split at any byte boundary.
+
+    uint64_t sum = 0;
+    uint32_t words[4];
+    uint16_t halfWord;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    while (aLength >= sizeof(words))
+    {
+        memcpy(words, aBuffer, sizeof(words));
+        sum += static_cast<uint64_t>(words[0]) + words[1] + words[2] + words[3];
+        aBuffer += sizeof(words);
+        aLength -= sizeof(words);
+    }
+
+    while (aLength >= sizeof(uint32_t))
     {
-        AddUint8(aBuffer[i]);
+        memcpy(words, aBuffer, sizeof(uint32_t));
+        sum += words[0];
+        aBuffer += sizeof(uint32_t);
+        aLength -= sizeof(uint32_t);
     }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        memcpy(&halfWord, aBuffer, sizeof(uint16_t));
+        sum += halfWord;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    AddUint16(BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
+    }
+
+exit:
+    return;
 }
 
-void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+uint16_t Checksum::GetFieldValue(void) const
 {
     uint16_t checksum = GetValue();
 
@@ -89,9 +145,58 @@ void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
         checksum = static_cast<uint16_t>(~checksum);
     }
 
-    checksum = BigEndian::HostSwap16(checksum);
+    return checksum;
+}
+
+void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+{
+    aMessage.Write(aOffset, BigEndian::HostSwap16(GetFieldValue()));
+}
+
+uint16_t Checksum::AdjustForData(uint16_t       aChecksum,
+                                 const uint8_t *aOldData,
+                                 uint16_t       aOldLength,
+                                 const uint8_t *aNewData,
+                                 uint16_t       aNewLength)
+{
+    // Per RFC 1624 (Eqn. 3): HC' = ~(~HC + ~m + m'). The one's
+    // complement of the old data `~m` is added as the complement of
+    // its sum. Both old and new data are expected to have even length
+    // and start at an even index in the checksummed data.
+
+    Checksum checksum;
+    Checksum oldDataSum;
+
+    oldDataSum.AddData(aOldData, aOldLength);
+
+    checksum.AddUint16(static_cast<uint16_t>(~aChecksum));
+    checksum.AddUint16(static_cast<uint16_t>(~oldDataSum.GetValue()));
+    checksum.AddData(aNewData, aNewLength);
+
+    return checksum.GetFieldValue();
+}
+
+uint16_t Checksum::Adjust(uint16_t aChecksum, const Ip6::Address &aOldAddress, const Ip4::Address &aNewAddress)
+{
+    return AdjustForData(aChecksum, aOldAddress.GetBytes(), sizeof(Ip6::Address), aNewAddress.GetBytes(),
+                         sizeof(Ip4::Address));
+}
+
+uint16_t Checksum::Adjust(uint16_t aChecksum, const Ip4::Address &aOldAddress, const Ip6::Address &aNewAddress)
+{
+    return AdjustForData(aChecksum, aOldAddress.GetBytes(), sizeof(Ip4::Address), aNewAddress.GetBytes(),
+                         sizeof(Ip6::Address));
+}
+
+uint16_t Checksum::Adjust(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue)
+{
+    uint8_t oldBytes[sizeof(uint16_t)];
+    uint8_t newBytes[sizeof(uint16_t)];
+
+    BigEndian::WriteUint16(aOldValue, oldBytes);
+    BigEndian::WriteUint16(aNewValue, newBytes);
 
-    aMessage.Write(aOffset, checksum);
+    return AdjustForData(aChecksum, oldBytes, sizeof(oldBytes), newBytes, sizeof(newBytes));
 }
 
 void Checksum::Calculate(const Ip6::Address &aSource,
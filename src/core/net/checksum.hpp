@@ -104,6 +104,41 @@ public:
      */
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
+    /**
+     * Incrementally adjusts a TCP/UDP checksum for an IPv6 address in the pseudo-header replaced by an IPv4
+     * address (RFC 1624).
+     *
+     * @param[in] aChecksum    The current checksum value (as in the TCP/UDP header).
+     * @param[in] aOldAddress  The IPv6 address being replaced.
+     * @param[in] aNewAddress  The new IPv4 address.
+     *
+     * @returns The adjusted checksum value.
+     */
+    static uint16_t Adjust(uint16_t aChecksum, const Ip6::Address &aOldAddress, const Ip4::Address &aNewAddress);
+
+    /**
+     * Incrementally adjusts a TCP/UDP checksum for an IPv4 address in the pseudo-header replaced by an IPv6
+     * address (RFC 1624).
+     *
+     * @param[in] aChecksum    The current checksum value (as in the TCP/UDP header).
+     * @param[in] aOldAddress  The IPv4 address being replaced.
+     * @param[in] aNewAddress  The new IPv6 address.
+     *
+     * @returns The adjusted checksum value.
+     */
+    static uint16_t Adjust(uint16_t aChecksum, const Ip4::Address &aOldAddress, const Ip6::Address &aNewAddress);
+
+    /**
+     * Incrementally adjusts a checksum for a 16-bit field (e.g., a TCP/UDP port) changing its value (RFC 1624).
+     *
+     * @param[in] aChecksum  The current checksum value.
+     * @param[in] aOldValue  The old value of the field.
+     * @param[in] aNewValue  The new value of the field.
+     *
+     * @returns The adjusted checksum value.
+     */
+    static uint16_t Adjust(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue);
+
 private:
     Checksum(void)
         : mValue(0)
@@ -115,6 +150,7 @@ private:
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
+    uint16_t GetFieldValue(void) const;
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
@@ -125,6 +161,12 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
+    static uint16_t AdjustForData(uint16_t       aChecksum,
+                                  const uint8_t *aOldData,
+                                  uint16_t       aOldLength,
+                                  const uint8_t *aNewData,
+                                  uint16_t       aNewLength);
+
     static constexpr uint16_t kValidRxChecksum = 0xffff;
 
     uint16_t mValue;
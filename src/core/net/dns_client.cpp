@@ -1194,7 +1194,11 @@ Error Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     if (aInfo.mQueryType == kServiceQuerySrvTxt)
     {
-        SuccessOrExit(error = AppendNameFromQuery(aQuery, *message));
+        // The second question uses the same name as the first one
+        // (which immediately follows the header), so a pointer to
+        // it is appended instead of repeating the full name.
+
+        SuccessOrExit(error = Name::AppendPointerLabel(sizeof(Header), *message));
         SuccessOrExit(error = message->Append(Question(ResourceRecord::kTypeTxt)));
     }
 #endif
@@ -880,6 +880,230 @@ bool Name::IsSameDomain(const char *aDomain1, const char *aDomain2)
     return IsSubDomainOf(aDomain1, aDomain2) && IsSubDomainOf(aDomain2, aDomain1);
 }
 
+Error NameCompressor::AppendName(const char *aFirstLabel, const char *aLabels, const char *aDomain, Message &aMessage)
+{
+    Error        error       = kErrorNone;
+    uint16_t     startOffset = aMessage.GetLength() - aMessage.GetOffset();
+    const Entry *match       = nullptr;
+    uint8_t      index;
+    EncodedName  name;
+
+    SuccessOrExit(error = name.Init(aFirstLabel, aLabels, aDomain));
+
+    // Find the longest suffix of the name which is already present
+    // in the message. `index` is the start of the suffix in the
+    // encoded name (first byte of a label).
+
+    for (index = 0; index < name.mLength; index += name.mBuffer[index] + 1)
+    {
+        match = FindEntry(name, index, aMessage);
+
+        if (match != nullptr)
+        {
+            break;
+        }
+    }
+
+    SuccessOrExit(error = aMessage.AppendBytes(name.mBuffer, index));
+
+    for (uint8_t labelIndex = 0; labelIndex < index; labelIndex += name.mBuffer[labelIndex] + 1)
+    {
+        AddEntry(name.CalculateSuffixHash(labelIndex), startOffset + labelIndex);
+    }
+
+    if (match != nullptr)
+    {
+        error = Name::AppendPointerLabel(match->mOffset, aMessage);
+    }
+    else
+    {
+        error = Name::AppendTerminator(aMessage);
+    }
+
+exit:
+    return error;
+}
+
+void NameCompressor::AddName(const char *aFirstLabel, const char *aLabels, const char *aDomain, uint16_t aOffset)
+{
+    EncodedName name;
+    uint32_t    hash;
+
+    SuccessOrExit(name.Init(aFirstLabel, aLabels, aDomain));
+    VerifyOrExit(name.mLength > 0);
+
+    hash = name.CalculateSuffixHash(0);
+
+    for (uint8_t i = 0; i < mNumEntries; i++)
+    {
+        VerifyOrExit((mEntries[i].mHash != hash) || (mEntries[i].mOffset != aOffset));
+    }
+
+    AddEntry(hash, aOffset);
+
+exit:
+    return;
+}
+
+const NameCompressor::Entry *NameCompressor::FindEntry(const EncodedName &aName,
+                                                       uint8_t            aIndex,
+                                                       const Message     &aMessage) const
+{
+    const Entry *match = nullptr;
+    uint32_t     hash  = aName.CalculateSuffixHash(aIndex);
+
+    for (uint8_t i = 0; i < mNumEntries; i++)
+    {
+        if ((mEntries[i].mHash == hash) && aName.MatchesSuffixAt(aIndex, aMessage, mEntries[i].mOffset))
+        {
+            match = &mEntries[i];
+            break;
+        }
+    }
+
+    return match;
+}
+
+void NameCompressor::AddEntry(uint32_t aHash, uint16_t aOffset)
+{
+    VerifyOrExit(mNumEntries < kMaxEntries);
+    VerifyOrExit(aOffset <= kMaxOffset);
+
+    mEntries[mNumEntries].mHash   = aHash;
+    mEntries[mNumEntries].mOffset = aOffset;
+    mNumEntries++;
+
+exit:
+    return;
+}
+
+Error NameCompressor::EncodedName::Init(const char *aFirstLabel, const char *aLabels, const char *aDomain)
+{
+    Error error = kErrorNone;
+
+    mLength = 0;
+
+    if (aFirstLabel != nullptr)
+    {
+        SuccessOrExit(error = AppendLabels(aFirstLabel, kIsSingleLabel));
+    }
+
+    SuccessOrExit(error = AppendLabels(aLabels, !kIsSingleLabel));
+    error = AppendLabels(aDomain, !kIsSingleLabel);
+
+exit:
+    return error;
+}
+
+Error NameCompressor::EncodedName::AppendLabels(const char *aLabels, bool aIsSingleLabel)
+{
+    Error    error           = kErrorNone;
+    uint16_t index           = 0;
+    uint16_t labelStartIndex = 0;
+    char     ch;
+
+    VerifyOrExit(aLabels != nullptr);
+
+    if (aIsSingleLabel)
+    {
+        ExitNow(error = AppendLabel(aLabels, static_cast<uint8_t>(StringLength(aLabels, Name::kMaxLabelSize))));
+    }
+
+    // Follows the same rules as `Name::AppendMultipleLabels()`: a
+    // trailing dot or a single dot (root) is allowed, but otherwise
+    // empty labels are invalid.
+
+    do
+    {
+        ch = aLabels[index];
+
+        if ((ch == kNullChar) || (ch == Name::kLabelSeparatorChar))
+        {
+            uint8_t labelLength = static_cast<uint8_t>(index - labelStartIndex);
+
+            if (labelLength == 0)
+            {
+                error =
+                    ((ch == kNullChar) || ((index == 0) && (aLabels[1] == kNullChar))) ? kErrorNone : kErrorInvalidArgs;
+                ExitNow();
+            }
+
+            VerifyOrExit(index + 1 < Name::kMaxNameSize, error = kErrorInvalidArgs);
+            SuccessOrExit(error = AppendLabel(&aLabels[labelStartIndex], labelLength));
+
+            labelStartIndex = index + 1;
+        }
+
+        index++;
+
+    } while (ch != kNullChar);
+
+exit:
+    return error;
+}
+
+Error NameCompressor::EncodedName::AppendLabel(const char *aLabel, uint8_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((0 < aLength) && (aLength <= Name::kMaxLabelLength), error = kErrorInvalidArgs);
+
+    // Keep room for the terminating root label.
+    VerifyOrExit(mLength + aLength + 1 < Name::kMaxNameSize, error = kErrorInvalidArgs);
+
+    mBuffer[mLength++] = aLength;
+    memcpy(&mBuffer[mLength], aLabel, aLength);
+    mLength += aLength;
+
+exit:
+    return error;
+}
+
+uint32_t NameCompressor::EncodedName::CalculateSuffixHash(uint8_t aIndex) const
+{
+    // Calculates FNV-1a hash over the encoded labels of the suffix
+    // starting at `aIndex`. Label chars are converted to lowercase
+    // so that the hash is case-insensitive (label length bytes are
+    // never in the uppercase ASCII range, so they are unchanged).
+
+    static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    static constexpr uint32_t kFnvPrime       = 16777619u;
+
+    uint32_t hash = kFnvOffsetBasis;
+
+    for (uint8_t i = aIndex; i < mLength; i++)
+    {
+        hash ^= static_cast<uint8_t>(ToLowercase(static_cast<char>(mBuffer[i])));
+        hash *= kFnvPrime;
+    }
+
+    return hash;
+}
+
+bool NameCompressor::EncodedName::MatchesSuffixAt(uint8_t aIndex, const Message &aMessage, uint16_t aOffset) const
+{
+    bool     matches = false;
+    uint16_t offset  = aMessage.GetOffset() + aOffset;
+
+    for (uint8_t i = aIndex; i < mLength; i += mBuffer[i] + 1)
+    {
+        Name::LabelBuffer label;
+
+        memcpy(label, &mBuffer[i + 1], mBuffer[i]);
+        label[mBuffer[i]] = kNullChar;
+
+        SuccessOrExit(Name::CompareLabel(aMessage, offset, label));
+    }
+
+    // All labels matched, check that the name in the message also
+    // ends here.
+
+    matches = (Name::CompareName(aMessage, offset, ".") == kErrorNone);
+
+exit:
+    return matches;
+}
+
 void ResourceRecord::UpdateRecordLengthInMessage(Message &aMessage, uint16_t aOffset)
 {
     ResourceRecord record;
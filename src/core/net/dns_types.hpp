@@ -1118,6 +1118,130 @@ private:
     uint16_t       mOffset;  // Offset in `mMessage` to the start of name (used when name is from `mMessage`).
 };
 
+/**
+ * Implements DNS name compression using a dictionary of name suffixes appended to a message.
+ *
+ * The dictionary maps the hash of each name suffix (a name and each of its parent domains) appended to a message to
+ * its offset in the message. When appending a new name, the longest suffix of the name which is already present in
+ * the message is replaced with a pointer label, and the newly appended suffixes are added to the dictionary.
+ *
+ * A `NameCompressor` is intended to be used with a single message and MUST be cleared when the message is re-used.
+ * A dictionary entry is always validated against the message content before it is used, so an entry which refers to
+ * a part of the message that is removed (e.g., the message is truncated) is never used.
+ */
+class NameCompressor : public Clearable<NameCompressor>
+{
+public:
+    /**
+     * Maximum number of name suffix entries tracked in the dictionary.
+     *
+     * When the dictionary is full, new names are still appended (and compressed using the existing entries), but their
+     * suffixes are no longer added.
+     */
+    static constexpr uint8_t kMaxEntries = 32;
+
+    /**
+     * Initializes the `NameCompressor` with an empty dictionary.
+     */
+    NameCompressor(void) { Clear(); }
+
+    /**
+     * Encodes and appends a full name to a message, using name compression when possible.
+     *
+     * The name is formed by @p aFirstLabel, followed by @p aLabels, followed by @p aDomain. Any of them can be
+     * `nullptr` to indicate it is not present.
+     *
+     * The @p aFirstLabel is appended as a single label and can contain dot '.' character (e.g., a service instance
+     * label). The @p aLabels and @p aDomain must follow "<label1>.<label2>.<label3>", i.e., a sequence of labels
+     * separated by dot '.' char (a trailing dot is allowed).
+     *
+     * `aMessage.GetOffset()` MUST point to the start of DNS header. The offsets saved in the dictionary are relative to
+     * the start of DNS header.
+     *
+     * @param[in] aFirstLabel  The first label to append (can be `nullptr`).
+     * @param[in] aLabels      The labels to append after @p aFirstLabel (can be `nullptr`).
+     * @param[in] aDomain      The domain name to append after @p aLabels (can be `nullptr`).
+     * @param[in] aMessage     The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  The name is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     */
+    Error AppendName(const char *aFirstLabel, const char *aLabels, const char *aDomain, Message &aMessage);
+
+    /**
+     * Encodes and appends a full name to a message, using name compression when possible.
+     *
+     * The @p aName must follow "<label1>.<label2>.<label3>", i.e., a sequence of labels separated by dot '.' char.
+     *
+     * @param[in] aName     A name string to append.
+     * @param[in] aMessage  The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  The name is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     */
+    Error AppendName(const char *aName, Message &aMessage) { return AppendName(nullptr, aName, nullptr, aMessage); }
+
+    /**
+     * Adds a name that is already present in the message to the dictionary.
+     *
+     * Can be used to let the `NameCompressor` use a name appended to the message without it (e.g., the question name
+     * copied from a query). Only the full name is added (not its parent domains). If the same name is already added
+     * at the same offset, the dictionary is not changed.
+     *
+     * The name is formed by @p aFirstLabel, followed by @p aLabels, followed by @p aDomain (same as in
+     * `AppendName()`).
+     *
+     * @param[in] aFirstLabel  The first label (can be `nullptr`).
+     * @param[in] aLabels      The labels after @p aFirstLabel (can be `nullptr`).
+     * @param[in] aDomain      The domain name after @p aLabels (can be `nullptr`).
+     * @param[in] aOffset      The offset of the name in the message (relative to the start of DNS header).
+     */
+    void AddName(const char *aFirstLabel, const char *aLabels, const char *aDomain, uint16_t aOffset);
+
+    /**
+     * Adds a name that is already present in the message to the dictionary.
+     *
+     * @param[in] aName     The name string.
+     * @param[in] aOffset   The offset of the name in the message (relative to the start of DNS header).
+     */
+    void AddName(const char *aName, uint16_t aOffset) { AddName(nullptr, aName, nullptr, aOffset); }
+
+private:
+    static constexpr uint16_t kMaxOffset     = 0x3fff; // Max offset that can be used in a pointer label.
+    static constexpr bool     kIsSingleLabel = true;
+
+    struct Entry
+    {
+        uint32_t mHash;
+        uint16_t mOffset;
+    };
+
+    struct EncodedName
+    {
+        EncodedName(void)
+            : mLength(0)
+        {
+        }
+
+        Error    Init(const char *aFirstLabel, const char *aLabels, const char *aDomain);
+        Error    AppendLabels(const char *aLabels, bool aIsSingleLabel);
+        Error    AppendLabel(const char *aLabel, uint8_t aLength);
+        uint32_t CalculateSuffixHash(uint8_t aIndex) const;
+        bool     MatchesSuffixAt(uint8_t aIndex, const Message &aMessage, uint16_t aOffset) const;
+
+        uint8_t mBuffer[Name::kMaxNameSize]; // Encoded labels (excluding the terminating root label).
+        uint8_t mLength;
+    };
+
+    const Entry *FindEntry(const EncodedName &aName, uint8_t aIndex, const Message &aMessage) const;
+    void         AddEntry(uint32_t aHash, uint16_t aOffset);
+
+    Entry   mEntries[kMaxEntries];
+    uint8_t mNumEntries;
+};
+
 /**
  * Represents a TXT record entry representing a key/value pair (RFC 6763 - section 6.3).
  */
@@ -573,9 +573,14 @@ Error Server::Response::AppendSrvRecord(const char *aHostName,
     recordOffset = mMessage->GetLength();
     SuccessOrExit(error = mMessage->Append(srvRecord));
 
+    // The host name is appended using `mNameCompressor` so that when
+    // multiple services of the same host are included in the response
+    // the host name is appended once and referred to by a pointer.
+
+    mNameCompressor.AddName(kDefaultDomainName, mOffsets.mDomainName);
+
     mOffsets.mHostName = mMessage->GetLength();
-    SuccessOrExit(error = Name::AppendMultipleLabels(hostLabels, *mMessage));
-    SuccessOrExit(error = Name::AppendPointerLabel(mOffsets.mDomainName, *mMessage));
+    SuccessOrExit(error = mNameCompressor.AppendName(nullptr, hostLabels, kDefaultDomainName, *mMessage));
 
     ResourceRecord::UpdateRecordLengthInMessage(*mMessage, recordOffset);
 
@@ -841,43 +846,59 @@ void Server::Response::Log(void) const
 
 Error Server::Response::ResolveBySrp(void)
 {
+    // Uses the SRP server name indices to find the host, the service
+    // instance, or the services (for PTR query) matching the query
+    // name. Deleted hosts and services (whose names are retained)
+    // are skipped.
+
     Error                       error          = kErrorNone;
+    const Srp::Server          &srpServer      = Get<Srp::Server>();
+    const Srp::Server::Host    *host;
     const Srp::Server::Service *matchedService = nullptr;
+    Name::Buffer                name;
+    uint16_t                    offset;
 
     mSection = kAnswerSection;
 
-    for (const Srp::Server::Host &host : Get<Srp::Server>().GetHosts())
+    ReadQueryName(name);
+
+    host = srpServer.FindHost(name);
+
+    if ((host != nullptr) && !host->IsDeleted())
     {
-        if (host.IsDeleted())
-        {
-            continue;
-        }
+        error = ResolveUsingSrpHost(*host);
+        ExitNow();
+    }
 
-        if (QueryNameMatches(host.GetFullName()))
+    for (const Srp::Server::Service *service = srpServer.FindNextServiceWithInstanceName(name, nullptr);
+         service != nullptr; service = srpServer.FindNextServiceWithInstanceName(name, service))
+    {
+        if (!service->IsDeleted() && !service->GetHost().IsDeleted())
         {
-            error = ResolveUsingSrpHost(host);
+            error = ResolveUsingSrpService(*service);
             ExitNow();
         }
+    }
 
-        for (const Srp::Server::Service &service : host.GetServices())
-        {
-            if (service.IsDeleted())
-            {
-                continue;
-            }
+    VerifyOrExit(mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny), error = kErrorNotFound);
 
-            if (QueryNameMatches(service.GetInstanceName()))
-            {
-                error = ResolveUsingSrpService(service);
-                ExitNow();
-            }
+    // `mOffsets.mServiceName` gives the base service name (the query
+    // name itself, or the labels after "_sub" for a sub-type service
+    // name).
 
-            if ((mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny)) && QueryNameMatchesService(service))
-            {
-                SuccessOrExit(error = AppendPtrRecord(service));
-                matchedService = &service;
-            }
+    offset = mOffsets.mServiceName;
+    SuccessOrExit(error = Name::ReadName(*mMessage, offset, name));
+
+    for (const Srp::Server::Service *service = srpServer.FindNextServiceWithServiceName(name, nullptr);
+         service != nullptr; service = srpServer.FindNextServiceWithServiceName(name, service))
+    {
+        if (service->IsDeleted() || service->GetHost().IsDeleted() || !QueryNameMatchesService(*service))
+        {
+            continue;
         }
+
+        SuccessOrExit(error = AppendPtrRecord(*service));
+        matchedService = service;
     }
 
     VerifyOrExit(matchedService != nullptr, error = kErrorNotFound);
@@ -487,6 +487,7 @@ private:
         Questions         mQuestions;
         Section           mSection;
         NameOffsets       mOffsets;
+        NameCompressor    mNameCompressor;
     };
 
     struct ProxyQueryInfo : Message::FooterData<ProxyQueryInfo>
@@ -1785,5 +1785,26 @@ uint16_t Headers::GetChecksum(void) const
     return checksum;
 }
 
+void Headers::SetChecksum(uint16_t aChecksum)
+{
+    switch (GetIpProto())
+    {
+    case kProtoUdp:
+        mHeader.mUdp.SetChecksum(aChecksum);
+        break;
+
+    case kProtoTcp:
+        mHeader.mTcp.SetChecksum(aChecksum);
+        break;
+
+    case kProtoIcmp6:
+        mHeader.mIcmp.SetChecksum(aChecksum);
+        break;
+
+    default:
+        break;
+    }
+}
+
 } // namespace Ip6
 } // namespace ot
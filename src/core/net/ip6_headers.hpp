@@ -901,6 +901,13 @@ public:
      */
     uint16_t GetChecksum(void) const { return BigEndian::HostSwap16(mChecksum); }
 
+    /**
+     * Sets the TCP Checksum.
+     *
+     * @param[in]  aChecksum  The TCP Checksum.
+     */
+    void SetChecksum(uint16_t aChecksum) { mChecksum = BigEndian::HostSwap16(aChecksum); }
+
     /**
      * Returns the TCP Urgent Pointer.
      *
@@ -151,6 +151,8 @@ Error Core::SetEnabled(bool aEnable, uint32_t aInfraIfIndex, Requester aRequeste
         LogInfo("%sisabling", (aRequester == kRequesterAuto) ? "Auto-d" : "D");
 
         mLocalHost.ClearAddresses();
+        mHostIndex.Clear();
+        mServiceIndex.Clear();
         mHostEntries.Clear();
         mServiceEntries.Clear();
         mServiceTypes.Clear();
@@ -267,13 +269,14 @@ Error Core::Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCa
 
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
 
-    entry = GetEntryList<EntryType>().FindMatching(aItemInfo);
+    entry = GetEntryIndex<EntryType>().FindMatching(aItemInfo);
 
     if (entry == nullptr)
     {
         entry = EntryType::AllocateAndInit(GetInstance(), aItemInfo);
         OT_ASSERT(entry != nullptr);
         GetEntryList<EntryType>().Push(*entry);
+        GetEntryIndex<EntryType>().Add(*entry);
     }
 
     entry->Register(aItemInfo, Callback(aRequestId, aCallback));
@@ -289,7 +292,7 @@ template <typename EntryType, typename ItemInfo> Error Core::Unregister(const It
 
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
 
-    entry = GetEntryList<EntryType>().FindMatching(aItemInfo);
+    entry = GetEntryIndex<EntryType>().FindMatching(aItemInfo);
 
     if (entry != nullptr)
     {
@@ -549,6 +552,27 @@ void Core::HandleEntryTimer(void)
 
 void Core::RemoveEmptyEntries(void)
 {
+    // Remove the entries from the name index (and from their
+    // `ServiceType`) before they are removed from the lists and
+    // freed.
+
+    for (HostEntry &entry : mHostEntries)
+    {
+        if (entry.GetState() == Entry::kRemoving)
+        {
+            mHostIndex.Remove(entry);
+        }
+    }
+
+    for (ServiceEntry &entry : mServiceEntries)
+    {
+        if (entry.GetState() == Entry::kRemoving)
+        {
+            entry.UpdateServiceTypes();
+            mServiceIndex.Remove(entry);
+        }
+    }
+
     mHostEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
     mServiceEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
 }
@@ -1938,6 +1962,8 @@ bool Core::LocalHost::AddrEvent::Matches(AddrType aType) const
 
 Core::HostEntry::HostEntry(void)
     : mNext(nullptr)
+    , mNextInIndex(nullptr)
+    , mNameHash(0)
     , mNameOffset(kUnspecifiedOffset)
 {
 }
@@ -1946,9 +1972,30 @@ Error Core::HostEntry::Init(Instance &aInstance, const char *aName)
 {
     Entry::Init(aInstance);
 
+    mNameHash = CalculateNameHash(aName);
+
     return mName.Set(aName);
 }
 
+uint32_t Core::HostEntry::CalculateNameHash(const char *aName)
+{
+    NameHash hash;
+
+    hash.AddLabels(aName);
+    hash.AddLabels(kLocalDomain);
+
+    return hash.GetValue();
+}
+
+uint32_t Core::HostEntry::CalculateNameHash(const Name &aName)
+{
+    NameHash hash;
+
+    hash.AddName(aName);
+
+    return hash.GetValue();
+}
+
 bool Core::HostEntry::Matches(const Name &aName) const
 {
     return aName.Matches(/* aFirstLabel */ nullptr, mName.AsCString(), kLocalDomain);
@@ -2485,6 +2532,9 @@ const uint8_t Core::ServiceEntry::kEmptyTxtData[] = {0};
 
 Core::ServiceEntry::ServiceEntry(void)
     : mNext(nullptr)
+    , mNextInIndex(nullptr)
+    , mNextOfType(nullptr)
+    , mNameHash(0)
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
@@ -2502,6 +2552,8 @@ Error Core::ServiceEntry::Init(Instance &aInstance, const char *aServiceInstance
 
     Entry::Init(aInstance);
 
+    mNameHash = CalculateNameHash(aServiceInstance, aServiceType);
+
     SuccessOrExit(error = mServiceInstance.Set(aServiceInstance));
     SuccessOrExit(error = mServiceType.Set(aServiceType));
 
@@ -2509,6 +2561,36 @@ exit:
     return error;
 }
 
+uint32_t Core::ServiceEntry::CalculateNameHash(const char *aServiceInstance, const char *aServiceType)
+{
+    NameHash hash;
+
+    hash.AddLabels(aServiceInstance);
+    hash.AddLabels(aServiceType);
+    hash.AddLabels(kLocalDomain);
+
+    return hash.GetValue();
+}
+
+uint32_t Core::ServiceEntry::CalculateNameHash(const Name &aFullName)
+{
+    NameHash hash;
+
+    hash.AddName(aFullName);
+
+    return hash.GetValue();
+}
+
+uint32_t Core::ServiceEntry::CalculateNameHash(const Service &aService)
+{
+    return CalculateNameHash(aService.mServiceInstance, aService.mServiceType);
+}
+
+uint32_t Core::ServiceEntry::CalculateNameHash(const Key &aKey)
+{
+    return CalculateNameHash(aKey.mName, aKey.mServiceType);
+}
+
 Error Core::ServiceEntry::Init(Instance &aInstance, const Service &aService)
 {
     return Init(aInstance, aService.mServiceInstance, aService.mServiceType);
@@ -3062,7 +3144,7 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
 
     // TODO: Need to handle name matching host name
 
-    aHostEntry = Get<Core>().mHostEntries.FindMatching(mHostName);
+    aHostEntry = Get<Core>().mHostIndex.FindMatching(mHostName);
 
     if ((aHostEntry != nullptr) && (aHostEntry->GetState() != GetState()))
     {
@@ -3156,11 +3238,11 @@ void Core::ServiceEntry::UpdateServiceTypes(void)
 
     if (shouldAdd)
     {
-        serviceType->IncrementNumEntries();
+        serviceType->AddEntry(*this);
     }
     else
     {
-        serviceType->DecrementNumEntries();
+        serviceType->RemoveEntry(*this);
 
         if (serviceType->GetNumEntries() == 0)
         {
@@ -3472,6 +3554,7 @@ Error Core::ServiceType::Init(Instance &aInstance, const char *aServiceType)
     InstanceLocatorInit::Init(aInstance);
 
     mNext       = nullptr;
+    mFirstEntry = nullptr;
     mNumEntries = 0;
     SuccessOrExit(error = mServiceType.Set(aServiceType));
 
@@ -3495,6 +3578,27 @@ bool Core::ServiceType::Matches(const Heap::String &aServiceType) const
     return NameMatch(aServiceType, mServiceType);
 }
 
+void Core::ServiceType::AddEntry(ServiceEntry &aEntry)
+{
+    aEntry.mNextOfType = mFirstEntry;
+    mFirstEntry        = &aEntry;
+    mNumEntries++;
+}
+
+void Core::ServiceType::RemoveEntry(ServiceEntry &aEntry)
+{
+    for (ServiceEntry **entryPtr = &mFirstEntry; *entryPtr != nullptr; entryPtr = &(*entryPtr)->mNextOfType)
+    {
+        if (*entryPtr == &aEntry)
+        {
+            *entryPtr          = aEntry.mNextOfType;
+            aEntry.mNextOfType = nullptr;
+            mNumEntries--;
+            break;
+        }
+    }
+}
+
 void Core::ServiceType::ClearAppendState(void) { mServicesPtr.MarkAsNotAppended(); }
 
 void Core::ServiceType::AnswerQuestion(const AnswerInfo &aInfo)
@@ -3620,6 +3724,76 @@ void Core::ServiceType::DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) c
     mServicesPtr.DetermineNextAggrTxTime(aNextAggrTxTime);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Core::NameHash
+
+void Core::NameHash::AddChar(char aChar)
+{
+    mHash ^= static_cast<uint8_t>(ToLowercase(aChar));
+    mHash *= kFnvPrime;
+}
+
+void Core::NameHash::AddLabels(const char *aLabels)
+{
+    // Adds a single label or multiple dot-separated labels. A
+    // trailing dot in `aLabels` (if any) is ignored.
+
+    VerifyOrExit((aLabels != nullptr) && (*aLabels != kNullChar));
+
+    if (!mIsEmpty)
+    {
+        AddChar('.');
+    }
+
+    mIsEmpty = false;
+
+    for (; *aLabels != kNullChar; aLabels++)
+    {
+        if ((*aLabels == '.') && (aLabels[1] == kNullChar))
+        {
+            break;
+        }
+
+        AddChar(*aLabels);
+    }
+
+exit:
+    return;
+}
+
+void Core::NameHash::AddName(const Name &aName)
+{
+    switch (aName.GetFromType())
+    {
+    case Name::kTypeEmpty:
+        break;
+
+    case Name::kTypeCString:
+        AddLabels(aName.GetAsCString());
+        break;
+
+    case Name::kTypeMessage:
+    {
+        uint16_t       offset;
+        const Message &message = aName.GetAsMessage(offset);
+
+        while (true)
+        {
+            Name::LabelBuffer label;
+            uint8_t           labelLength = sizeof(label);
+
+            SuccessOrExit(Name::ReadLabel(message, offset, label, labelLength));
+            AddLabels(label);
+        }
+
+        break;
+    }
+    }
+
+exit:
+    return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Core::TxMessage
 
@@ -3649,6 +3823,7 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
     mTcpOffset           = kUnspecifiedOffset;
     mServicesDnssdOffset = kUnspecifiedOffset;
     mType                = aType;
+    mNameCompressor.Clear();
 
     // Allocate messages. The main `mMsgPtr` is always allocated.
     // The Authority and Addition section messages are allocated
@@ -3856,6 +4031,50 @@ exit:
     return;
 }
 
+void Core::TxMessage::AppendName(Section aSection, const char *aFirstLabel, const char *aLabels)
+{
+    // Appends a full name formed by `aFirstLabel` (as a single
+    // label, can be `nullptr`) followed by `aLabels` and the
+    // `.local.` domain.
+    //
+    // When appending to the main message, `mNameCompressor` is used
+    // so that any suffix of the name previously appended by this
+    // method (e.g., the same service type or the same service
+    // instance name in different questions) is replaced with a
+    // pointer. Otherwise the labels are appended followed by the
+    // (possibly compressed) domain name.
+
+    Message &message     = SelectMessageFor(aSection);
+    uint16_t startOffset = message.GetLength();
+
+    if ((&message == mMsgPtr.Get()) && (mDomainOffset != kUnspecifiedOffset))
+    {
+        mNameCompressor.AddName(kLocalDomain, mDomainOffset);
+        SuccessOrAssert(mNameCompressor.AppendName(aFirstLabel, aLabels, kLocalDomain, message));
+        ExitNow();
+    }
+
+    if (aFirstLabel != nullptr)
+    {
+        SuccessOrAssert(Name::AppendLabel(aFirstLabel, message));
+    }
+
+    if (aLabels != nullptr)
+    {
+        SuccessOrAssert(Name::AppendMultipleLabels(aLabels, message));
+    }
+
+    AppendDomainName(aSection);
+
+    if (&message == mMsgPtr.Get())
+    {
+        mNameCompressor.AddName(aFirstLabel, aLabels, kLocalDomain, startOffset);
+    }
+
+exit:
+    return;
+}
+
 void Core::TxMessage::AddQuestionFrom(const Message &aMessage)
 {
     uint16_t offset = sizeof(Header);
@@ -4375,11 +4594,11 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 
     // Check if question name matches a `HostEntry` or a `ServiceEntry`.
 
-    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(name);
+    aQuestion.mEntry = Get<Core>().mHostIndex.FindMatching(name);
 
     if (aQuestion.mEntry == nullptr)
     {
-        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(name);
+        aQuestion.mEntry        = Get<Core>().mServiceIndex.FindMatching(name);
         aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
     }
 
@@ -4418,6 +4637,7 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
         bool              isSubType;
         Name::LabelBuffer subLabel;
         Name              baseType;
+        ServiceType      *serviceType;
 
         VerifyOrExit(QuestionMatches(aQuestion.mRrType, ResourceRecord::kTypePtr));
 
@@ -4428,20 +4648,31 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
             baseType = name;
         }
 
-        for (ServiceEntry &serviceEntry : Get<Core>().mServiceEntries)
+        // A `ServiceType` tracks all the entries of its type which are
+        // registered and whose PTR record can be answered. The same is
+        // required by `MatchesServiceType()`, so walking this chain
+        // finds the same entries as checking all `mServiceEntries`
+        // (e.g., an entry sending goodbyes after being unregistered is
+        // not tracked and was not matched before either).
+
+        serviceType = Get<Core>().mServiceTypes.FindMatching(baseType);
+        VerifyOrExit(serviceType != nullptr);
+
+        for (ServiceEntry *serviceEntry = serviceType->GetFirstEntry(); serviceEntry != nullptr;
+             serviceEntry               = serviceEntry->GetNextOfType())
         {
-            if ((serviceEntry.GetState() != Entry::kRegistered) || !serviceEntry.MatchesServiceType(baseType))
+            if ((serviceEntry->GetState() != Entry::kRegistered) || !serviceEntry->MatchesServiceType(baseType))
             {
                 continue;
             }
 
-            if (isSubType && !serviceEntry.CanAnswerSubType(subLabel))
+            if (isSubType && !serviceEntry->CanAnswerSubType(subLabel))
             {
                 continue;
             }
 
             aQuestion.mCanAnswer     = true;
-            aQuestion.mEntry         = &serviceEntry;
+            aQuestion.mEntry         = serviceEntry;
             aQuestion.mIsForService  = true;
             aQuestion.mIsServiceType = true;
             ExitNow();
@@ -4518,7 +4749,8 @@ void Core::RxMessage::AnswerServiceTypeQuestion(const Question   &aQuestion,
         subLabel = nullptr;
     }
 
-    for (ServiceEntry *serviceEntry = &aFirstEntry; serviceEntry != nullptr; serviceEntry = serviceEntry->GetNext())
+    for (ServiceEntry *serviceEntry = &aFirstEntry; serviceEntry != nullptr;
+         serviceEntry               = serviceEntry->GetNextOfType())
     {
         bool shouldSuppress = false;
 
@@ -4812,14 +5044,14 @@ void Core::RxMessage::ProcessRecordForConflict(const Name &aName, const Resource
 
     VerifyOrExit(aRecord.GetTtl() > 0);
 
-    hostEntry = Get<Core>().mHostEntries.FindMatching(aName);
+    hostEntry = Get<Core>().mHostIndex.FindMatching(aName);
 
     if (hostEntry != nullptr)
     {
         hostEntry->HandleConflict();
     }
 
-    serviceEntry = Get<Core>().mServiceEntries.FindMatching(aName);
+    serviceEntry = Get<Core>().mServiceIndex.FindMatching(aName);
 
     if (serviceEntry != nullptr)
     {
@@ -6880,17 +7112,7 @@ void Core::AddrCache::PrepareQueryQuestion(TxMessage &aQuery, uint16_t aRrType)
 
 void Core::AddrCache::AppendNameTo(TxMessage &aTxMessage, Section aSection)
 {
-    uint16_t compressOffset = kUnspecifiedOffset;
-
-    AppendOutcome outcome;
-
-    outcome = aTxMessage.AppendMultipleLabels(aSection, mName.AsCString(), compressOffset);
-    VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
-
-    aTxMessage.AppendDomainName(aSection);
-
-exit:
-    return;
+    aTxMessage.AppendName(aSection, nullptr, mName.AsCString());
 }
 
 void Core::AddrCache::UpdateRecordStateAfterQuery(TimeMilli aNow)
@@ -7326,23 +7548,7 @@ void Core::RecordCache::PrepareQueryQuestion(TxMessage &aQuery)
 
 void Core::RecordCache::AppendNameTo(TxMessage &aTxMessage, Section aSection)
 {
-    uint16_t      compressOffset = kUnspecifiedOffset;
-    AppendOutcome outcome;
-
-    outcome = aTxMessage.AppendLabel(aSection, mFirstLabel.AsCString(), compressOffset);
-    VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
-
-    if (!mNextLabels.IsNull())
-    {
-        compressOffset = kUnspecifiedOffset;
-        outcome        = aTxMessage.AppendMultipleLabels(aSection, mNextLabels.AsCString(), compressOffset);
-        VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
-    }
-
-    aTxMessage.AppendDomainName(aSection);
-
-exit:
-    return;
+    aTxMessage.AppendName(aSection, mFirstLabel.AsCString(), mNextLabels.AsCString());
 }
 
 void Core::RecordCache::UpdateRecordStateAfterQuery(TimeMilli aNow)
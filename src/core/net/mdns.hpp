@@ -975,6 +975,7 @@ private:
     class ServiceEntry;
     class ServiceType;
     class EntryIterator;
+    template <typename EntryType> class EntryIndex;
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
@@ -1281,6 +1282,7 @@ private:
         friend class LinkedListEntry<HostEntry>;
         friend class Entry;
         friend class ServiceEntry;
+        friend class EntryIndex<HostEntry>;
 
     public:
         HostEntry(void);
@@ -1337,9 +1339,20 @@ private:
         void  AppendNameTo(TxMessage &aTxMessage, Section aSection);
         void  MarkToAppendAddrRecordsInAdditionalData(void);
 
-        static void AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
+        static void     AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
+        static uint32_t CalculateNameHash(const char *aName);
+        static uint32_t CalculateNameHash(const Name &aName);
+        static uint32_t CalculateNameHash(const Host &aHost) { return CalculateNameHash(aHost.mHostName); }
+        static uint32_t CalculateNameHash(const LocalHost &aLocalHost)
+        {
+            return CalculateNameHash(aLocalHost.GetName());
+        }
+        static uint32_t CalculateNameHash(const Key &aKey) { return CalculateNameHash(aKey.mName); }
+        static uint32_t CalculateNameHash(const Heap::String &aName) { return CalculateNameHash(aName.AsCString()); }
 
         HostEntry           *mNext;
+        HostEntry           *mNextInIndex;
+        uint32_t             mNameHash;
         Heap::String         mName;
         AddrRecord           mIp6AddrRecord;
         OwnedPtr<AddrRecord> mIp4AddrRecord;
@@ -1353,34 +1366,37 @@ private:
         friend class LinkedListEntry<ServiceEntry>;
         friend class Entry;
         friend class ServiceType;
+        friend class EntryIndex<ServiceEntry>;
 
     public:
         ServiceEntry(void);
-        Error Init(Instance &aInstance, const Service &aService);
-        Error Init(Instance &aInstance, const Key &aKey);
-        bool  IsEmpty(void) const;
-        bool  Matches(const Name &aFullName) const;
-        bool  Matches(const Service &aService) const;
-        bool  Matches(const Key &aKey) const;
-        bool  Matches(State aState) const { return GetState() == aState; }
-        bool  Matches(const ServiceEntry &aEntry) const { return (this == &aEntry); }
-        bool  MatchesServiceType(const Name &aServiceType) const;
-        bool  CanAnswerSubType(const char *aSubLabel) const;
-        void  Register(const Service &aService, const Callback &aCallback);
-        void  Register(const Key &aKey, const Callback &aCallback);
-        void  Unregister(const Service &aService);
-        void  Unregister(const Key &aKey);
-        void  AnswerServiceNameQuestion(const AnswerInfo &aInfo);
-        void  AnswerServiceTypeQuestion(const AnswerInfo &aInfo, const char *aSubLabel);
-        bool  ShouldSuppressKnownAnswer(uint32_t aTtl, const char *aSubLabel) const;
-        void  HandleTimer(EntryContext &aContext);
-        void  ClearAppendState(void);
-        void  PrepareResponse(EntryContext &aContext);
-        void  HandleConflict(void);
-        void  DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
+        Error         Init(Instance &aInstance, const Service &aService);
+        Error         Init(Instance &aInstance, const Key &aKey);
+        bool          IsEmpty(void) const;
+        bool          Matches(const Name &aFullName) const;
+        bool          Matches(const Service &aService) const;
+        bool          Matches(const Key &aKey) const;
+        bool          Matches(State aState) const { return GetState() == aState; }
+        bool          Matches(const ServiceEntry &aEntry) const { return (this == &aEntry); }
+        ServiceEntry *GetNextOfType(void) { return mNextOfType; }
+        bool          MatchesServiceType(const Name &aServiceType) const;
+        bool          CanAnswerSubType(const char *aSubLabel) const;
+        void          Register(const Service &aService, const Callback &aCallback);
+        void          Register(const Key &aKey, const Callback &aCallback);
+        void          Unregister(const Service &aService);
+        void          Unregister(const Key &aKey);
+        void          AnswerServiceNameQuestion(const AnswerInfo &aInfo);
+        void          AnswerServiceTypeQuestion(const AnswerInfo &aInfo, const char *aSubLabel);
+        bool          ShouldSuppressKnownAnswer(uint32_t aTtl, const char *aSubLabel) const;
+        void          UpdateServiceTypes(void);
+        void          HandleTimer(EntryContext &aContext);
+        void          ClearAppendState(void);
+        void          PrepareResponse(EntryContext &aContext);
+        void          HandleConflict(void);
+        void          DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
-        Error CopyInfoTo(Service &aService, EntryState &aState, EntryIterator &aIterator) const;
-        Error CopyInfoTo(Key &aKey, EntryState &aState) const;
+        Error         CopyInfoTo(Service &aService, EntryState &aState, EntryIterator &aIterator) const;
+        Error         CopyInfoTo(Key &aKey, EntryState &aState) const;
 #endif
 
     private:
@@ -1407,7 +1423,6 @@ private:
         void  UpdateRecordsState(const TxMessage &aResponse);
         void  DetermineNextFireTime(void);
         void  DiscoverOffsetsAndHost(HostEntry *&aHost);
-        void  UpdateServiceTypes(void);
         void  AppendSrvRecordTo(TxMessage &aTxMessage, Section aSection);
         void  AppendTxtRecordTo(TxMessage &aTxMessage, Section aSection);
         void  AppendPtrRecordTo(TxMessage &aTxMessage, Section aSection, SubType *aSubType = nullptr);
@@ -1419,11 +1434,18 @@ private:
         void  AppendSubServiceNameTo(TxMessage &aTxMessage, Section aSection, SubType &aSubType);
         void  AppendHostNameTo(TxMessage &aTxMessage, Section aSection);
 
-        static void AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
+        static void     AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
+        static uint32_t CalculateNameHash(const char *aServiceInstance, const char *aServiceType);
+        static uint32_t CalculateNameHash(const Name &aFullName);
+        static uint32_t CalculateNameHash(const Service &aService);
+        static uint32_t CalculateNameHash(const Key &aKey);
 
         static const uint8_t kEmptyTxtData[];
 
         ServiceEntry       *mNext;
+        ServiceEntry       *mNextInIndex;
+        ServiceEntry       *mNextOfType;
+        uint32_t            mNameHash;
         Heap::String        mServiceInstance;
         Heap::String        mServiceType;
         RecordInfo          mPtrRecord;
@@ -1456,28 +1478,124 @@ private:
         friend class LinkedListEntry<ServiceType>;
 
     public:
-        Error    Init(Instance &aInstance, const char *aServiceType);
-        bool     Matches(const Name &aServiceTypeName) const;
-        bool     Matches(const Heap::String &aServiceType) const;
-        bool     Matches(const ServiceType &aServiceType) const { return (this == &aServiceType); }
-        void     IncrementNumEntries(void) { mNumEntries++; }
-        void     DecrementNumEntries(void) { mNumEntries--; }
-        uint16_t GetNumEntries(void) const { return mNumEntries; }
-        void     ClearAppendState(void);
-        void     AnswerQuestion(const AnswerInfo &aInfo);
-        bool     ShouldSuppressKnownAnswer(uint32_t aTtl) const;
-        void     HandleTimer(EntryContext &aContext);
-        void     PrepareResponse(EntryContext &aContext);
-        void     DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
+        Error         Init(Instance &aInstance, const char *aServiceType);
+        bool          Matches(const Name &aServiceTypeName) const;
+        bool          Matches(const Heap::String &aServiceType) const;
+        bool          Matches(const ServiceType &aServiceType) const { return (this == &aServiceType); }
+        void          AddEntry(ServiceEntry &aEntry);
+        void          RemoveEntry(ServiceEntry &aEntry);
+        uint16_t      GetNumEntries(void) const { return mNumEntries; }
+        ServiceEntry *GetFirstEntry(void) { return mFirstEntry; }
+        void          ClearAppendState(void);
+        void          AnswerQuestion(const AnswerInfo &aInfo);
+        bool          ShouldSuppressKnownAnswer(uint32_t aTtl) const;
+        void          HandleTimer(EntryContext &aContext);
+        void          PrepareResponse(EntryContext &aContext);
+        void          DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
 
     private:
         void PrepareResponseRecords(EntryContext &aContext);
         void AppendPtrRecordTo(TxMessage &aResponse, uint16_t aServiceTypeOffset);
 
-        ServiceType *mNext;
-        Heap::String mServiceType;
-        RecordInfo   mServicesPtr;
-        uint16_t     mNumEntries; // Number of service entries providing this service type.
+        ServiceType  *mNext;
+        Heap::String  mServiceType;
+        RecordInfo    mServicesPtr;
+        ServiceEntry *mFirstEntry; // Head of the chain of service entries (linked by `mNextOfType`).
+        uint16_t      mNumEntries; // Number of service entries providing this service type.
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    class NameHash
+    {
+        // Calculates a case-insensitive hash (FNV-1a) of a DNS name.
+        // Labels are hashed as a sequence of chars separated by dot
+        // char, so that a name read from a message (label by label)
+        // and the same name given as a dot-separated C string result
+        // in the same hash value.
+
+    public:
+        NameHash(void)
+            : mHash(kFnvOffsetBasis)
+            , mIsEmpty(true)
+        {
+        }
+
+        void     AddLabels(const char *aLabels);
+        void     AddName(const Name &aName);
+        uint32_t GetValue(void) const { return mHash; }
+
+    private:
+        static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+        static constexpr uint32_t kFnvPrime       = 16777619u;
+
+        void AddChar(char aChar);
+
+        uint32_t mHash;
+        bool     mIsEmpty;
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    template <typename EntryType> class EntryIndex : private NonCopyable
+    {
+        // Indexes `HostEntry` or `ServiceEntry` entries by their name
+        // hash. Entries are chained in buckets using `mNextInIndex`.
+        // An entry is added to the index when it is allocated and
+        // pushed in its `OwningList` and is removed from the index
+        // before it is removed from the list and freed.
+
+    public:
+        EntryIndex(void) { Clear(); }
+
+        void Clear(void) { ClearAllBytes(mBuckets); }
+
+        void Add(EntryType &aEntry)
+        {
+            EntryType *&bucket = GetBucket(aEntry.mNameHash);
+
+            aEntry.mNextInIndex = bucket;
+            bucket              = &aEntry;
+        }
+
+        void Remove(EntryType &aEntry)
+        {
+            for (EntryType **entryPtr = &GetBucket(aEntry.mNameHash); *entryPtr != nullptr;
+                 entryPtr             = &(*entryPtr)->mNextInIndex)
+            {
+                if (*entryPtr == &aEntry)
+                {
+                    *entryPtr           = aEntry.mNextInIndex;
+                    aEntry.mNextInIndex = nullptr;
+                    break;
+                }
+            }
+        }
+
+        template <typename NameType> EntryType *FindMatching(const NameType &aName)
+        {
+            uint32_t   hash  = EntryType::CalculateNameHash(aName);
+            EntryType *entry = GetBucket(hash);
+
+            for (; entry != nullptr; entry = entry->mNextInIndex)
+            {
+                if ((entry->mNameHash == hash) && entry->Matches(aName))
+                {
+                    break;
+                }
+            }
+
+            return entry;
+        }
+
+    private:
+        static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_INDEX_SIZE;
+
+        static_assert(kNumBuckets > 0, "OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_INDEX_SIZE must be non-zero");
+
+        EntryType *&GetBucket(uint32_t aHash) { return mBuckets[aHash % kNumBuckets]; }
+
+        EntryType *mBuckets[kNumBuckets];
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1503,6 +1621,7 @@ private:
         void          AppendServiceType(Section aSection, const char *aServiceType, uint16_t &aCompressOffset);
         void          AppendDomainName(Section aSection);
         void          AppendServicesDnssdName(Section aSection);
+        void          AppendName(Section aSection, const char *aFirstLabel, const char *aLabels);
         void          AddQuestionFrom(const Message &aMessage);
         void          IncrementRecordCount(Section aSection) { mRecordCounts.Increment(aSection); }
         void          CheckSizeLimitToPrepareAgain(bool &aPrepareAgain);
@@ -1536,6 +1655,7 @@ private:
         uint16_t          mUdpOffset;           // Offset to `_udp.local.`
         uint16_t          mTcpOffset;           // Offset to `_tcp.local.`
         uint16_t          mServicesDnssdOffset; // Offset to `_services._dns-sd`
+        NameCompressor    mNameCompressor;      // Suffix compression of full names in main message.
         AddressInfo       mUnicastDest;
         Type              mType;
     };
@@ -2328,6 +2448,7 @@ private:
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     template <typename EntryType> OwningList<EntryType> &GetEntryList(void);
+    template <typename EntryType> EntryIndex<EntryType> &GetEntryIndex(void);
     template <typename EntryType, typename ItemInfo>
     Error Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCallback aCallback);
     template <typename EntryType, typename ItemInfo> Error Unregister(const ItemInfo &aItemInfo);
@@ -2399,6 +2520,8 @@ private:
     LocalHost                mLocalHost;
     OwningList<HostEntry>    mHostEntries;
     OwningList<ServiceEntry> mServiceEntries;
+    EntryIndex<HostEntry>    mHostIndex;
+    EntryIndex<ServiceEntry> mServiceIndex;
     OwningList<ServiceType>  mServiceTypes;
     MultiPacketRxMessages    mMultiPacketRxMessages;
     TimeMilli                mNextProbeTxTime;
@@ -2430,6 +2553,15 @@ template <> inline OwningList<Core::ServiceEntry> &Core::GetEntryList<Core::Serv
     return mServiceEntries;
 }
 
+// Specializations of `Core::GetEntryIndex()` for `HostEntry` and `ServiceEntry`:
+
+template <> inline Core::EntryIndex<Core::HostEntry> &Core::GetEntryIndex<Core::HostEntry>(void) { return mHostIndex; }
+
+template <> inline Core::EntryIndex<Core::ServiceEntry> &Core::GetEntryIndex<Core::ServiceEntry>(void)
+{
+    return mServiceIndex;
+}
+
 // Specializations of `Core::GetCacheList()`:
 
 template <> inline OwningList<Core::BrowseCache> &Core::GetCacheList<Core::BrowseCache>(void)
@@ -72,6 +72,8 @@ Translator::Translator(Instance &aInstance)
 
     mCounters.Clear();
     ClearAllBytes(mErrorCounters);
+    ClearAllBytes(mLookupCounters);
+    ClearIndex();
 }
 
 Message *Translator::NewIp4Message(const Message::Settings &aSettings)
@@ -107,14 +109,66 @@ uint16_t Translator::GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers
     return aIp4Headers.IsIcmp4() ? aIp4Headers.GetIcmpHeader().GetId() : aIp4Headers.GetDestinationPort();
 }
 
+bool Translator::UpdatePortAndChecksum(Ip6::Headers &aIp6Headers, const Ip4::Header &aIp4Header, uint16_t aSrcPort)
+{
+    // Adjusts the TCP/UDP checksum incrementally (RFC 1624) for the
+    // pseudo-header addresses and the source port changed by the
+    // translation. The payload length and the protocol number in the
+    // pseudo-header are the same for IPv6 and IPv4, so the payload
+    // does not need to be summed again. Returns `false` if the
+    // checksum cannot be adjusted (a UDP datagram with a zero
+    // checksum) and needs to be calculated over the whole message.
+
+    uint16_t checksum = aIp6Headers.GetChecksum();
+    bool     adjusted = false;
+
+    if (!aIp6Headers.IsUdp() || (checksum != 0))
+    {
+        checksum = Checksum::Adjust(checksum, aIp6Headers.GetSourceAddress(), aIp4Header.GetSource());
+        checksum = Checksum::Adjust(checksum, aIp6Headers.GetDestinationAddress(), aIp4Header.GetDestination());
+        checksum = Checksum::Adjust(checksum, aIp6Headers.GetSourcePort(), aSrcPort);
+
+        aIp6Headers.SetChecksum(checksum);
+        adjusted = true;
+    }
+
+    aIp6Headers.SetSourcePort(aSrcPort);
+
+    return adjusted;
+}
+
+bool Translator::UpdatePortAndChecksum(Ip4::Headers &aIp4Headers, const Ip6::Header &aIp6Header, uint16_t aDstPort)
+{
+    // Same as above for IPv4 to IPv6 translation. A zero UDP checksum
+    // means no checksum in IPv4, but it is mandatory in IPv6.
+
+    uint16_t checksum = aIp4Headers.GetChecksum();
+    bool     adjusted = false;
+
+    if (!aIp4Headers.IsUdp() || (checksum != 0))
+    {
+        checksum = Checksum::Adjust(checksum, aIp4Headers.GetSourceAddress(), aIp6Header.GetSource());
+        checksum = Checksum::Adjust(checksum, aIp4Headers.GetDestinationAddress(), aIp6Header.GetDestination());
+        checksum = Checksum::Adjust(checksum, aIp4Headers.GetDestinationPort(), aDstPort);
+
+        aIp4Headers.SetChecksum(checksum);
+        adjusted = true;
+    }
+
+    aIp4Headers.SetDestinationPort(aDstPort);
+
+    return adjusted;
+}
+
 Error Translator::TranslateIp6ToIp4(Message &aMessage)
 {
     Error        error      = kErrorNone;
     DropReason   dropReason = kReasonUnknown;
     Ip6::Headers ip6Headers;
     Ip4::Header  ip4Header;
-    uint16_t     srcPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    uint16_t     srcPortOrId         = 0;
+    Mapping     *mapping             = nullptr;
+    bool         shouldCalculateFull = true;
 
     VerifyOrExit(mState == kStateActive, error = kErrorAbort);
 
@@ -132,7 +186,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorAbort);
     }
 
-    mapping = mActiveMappings.FindMatching(ip6Headers);
+    mapping = FindMapping(ip6Headers);
 
     if (mapping == nullptr)
     {
@@ -169,12 +223,12 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // The IP header is consumed, so the next header is at offset 0.
     case Ip6::kProtoUdp:
         ip4Header.SetProtocol(Ip4::kProtoUdp);
-        ip6Headers.SetSourcePort(srcPortOrId);
+        shouldCalculateFull = !UpdatePortAndChecksum(ip6Headers, ip4Header, srcPortOrId);
         aMessage.Write(0, ip6Headers.GetUdpHeader());
         break;
     case Ip6::kProtoTcp:
         ip4Header.SetProtocol(Ip4::kProtoTcp);
-        ip6Headers.SetSourcePort(srcPortOrId);
+        shouldCalculateFull = !UpdatePortAndChecksum(ip6Headers, ip4Header, srcPortOrId);
         aMessage.Write(0, ip6Headers.GetTcpHeader());
         break;
     case Ip6::kProtoIcmp6:
@@ -189,8 +243,14 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    // ICMPv6 and ICMP(v4) differ in message types and pseudo-header
+    // usage, so the ICMP checksum is calculated over the whole message.
+    if (shouldCalculateFull)
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
+                                        ip4Header.GetProtocol());
+    }
+
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
 
     if (aMessage.Prepend(ip4Header) != kErrorNone)
@@ -221,8 +281,9 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     DropReason   dropReason = kReasonUnknown;
     Ip6::Header  ip6Header;
     Ip4::Headers ip4Headers;
-    uint16_t     dstPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    uint16_t     dstPortOrId         = 0;
+    Mapping     *mapping             = nullptr;
+    bool         shouldCalculateFull = true;
 
     VerifyOrExit(mState == kStateActive, error = kErrorDrop);
 
@@ -232,7 +293,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping = mActiveMappings.FindMatching(ip4Headers);
+    mapping = FindMapping(ip4Headers);
 
     if (mapping == nullptr)
     {
@@ -267,12 +328,12 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     // The IP header is consumed , so the next header is at offset 0.
     case Ip4::kProtoUdp:
         ip6Header.SetNextHeader(Ip6::kProtoUdp);
-        ip4Headers.SetDestinationPort(dstPortOrId);
+        shouldCalculateFull = !UpdatePortAndChecksum(ip4Headers, ip6Header, dstPortOrId);
         aMessage.Write(0, ip4Headers.GetUdpHeader());
         break;
     case Ip4::kProtoTcp:
         ip6Header.SetNextHeader(Ip6::kProtoTcp);
-        ip4Headers.SetDestinationPort(dstPortOrId);
+        shouldCalculateFull = !UpdatePortAndChecksum(ip4Headers, ip6Header, dstPortOrId);
         aMessage.Write(0, ip4Headers.GetTcpHeader());
         break;
     case Ip4::kProtoIcmp:
@@ -287,8 +348,11 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    if (shouldCalculateFull)
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                        ip6Header.GetNextHeader());
+    }
 
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
@@ -350,9 +414,144 @@ void Translator::Mapping::Free(void)
 {
     LogInfo("Mapping removed: %s", ToString().AsCString());
 
+    Get<Translator>().RemoveFromIndex(*this);
     Get<Translator>().mMappingPool.Free(*this);
 }
 
+uint16_t Translator::Mapping::GetIndexSlot(IndexKey aKey) const
+{
+    uint16_t slot;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    slot = (aKey == kIp6Key) ? GetIp6IndexSlot(mIp6Address, mSrcPortOrId) : GetIp4IndexSlot(mTranslatedPortOrId);
+#else
+    slot = (aKey == kIp6Key) ? GetIp6IndexSlot(mIp6Address, 0) : GetIp4IndexSlot(mIp4Address.mFields.m32);
+#endif
+
+    return slot;
+}
+
+uint16_t Translator::GetIp6IndexSlot(const Ip6::Address &aIp6Address, uint16_t aSrcPortOrId)
+{
+    IndexHasher hasher(aSrcPortOrId);
+
+    hasher.Mix(aIp6Address.mFields.m32);
+
+    return MappingIndex::GetHomeSlot(hasher.GetFinalizedHash());
+}
+
+uint16_t Translator::GetIp4IndexSlot(uint32_t aKey)
+{
+    IndexHasher hasher;
+
+    hasher.Mix(aKey);
+
+    return MappingIndex::GetHomeSlot(hasher.GetFinalizedHash());
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip6::Headers &aIp6Headers)
+{
+    Mapping *mapping;
+    uint32_t numProbes;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    uint16_t slot = GetIp6IndexSlot(aIp6Headers.GetSourceAddress(), GetSourcePortOrIcmp6Id(aIp6Headers));
+#else
+    uint16_t slot = GetIp6IndexSlot(aIp6Headers.GetSourceAddress(), 0);
+#endif
+
+    mapping = FindIndexedMapping(kIp6Key, slot, aIp6Headers, numProbes);
+    UpdateLookupCounters(mapping, numProbes);
+
+    return mapping;
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip4::Headers &aIp4Headers)
+{
+    Mapping *mapping;
+    uint32_t numProbes;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    uint16_t slot = GetIp4IndexSlot(GetDestinationPortOrIcmp4Id(aIp4Headers));
+#else
+    uint16_t slot = GetIp4IndexSlot(aIp4Headers.GetDestinationAddress().mFields.m32);
+#endif
+
+    mapping = FindIndexedMapping(kIp4Key, slot, aIp4Headers, numProbes);
+    UpdateLookupCounters(mapping, numProbes);
+
+    return mapping;
+}
+
+template <typename MatcherType>
+Translator::Mapping *Translator::FindIndexedMapping(IndexKey           aKey,
+                                                    uint16_t           aSlot,
+                                                    const MatcherType &aMatcher,
+                                                    uint32_t          &aNumProbes)
+{
+    Mapping *mapping = nullptr;
+
+    aNumProbes = 0;
+
+    for (; mIndex[aKey].HasEntryAt(aSlot); aSlot = MappingIndex::GetNextSlot(aSlot))
+    {
+        Mapping &entry = mMappingPool.GetEntryAt(mIndex[aKey].GetEntryAt(aSlot));
+
+        aNumProbes++;
+
+        if (entry.Matches(aMatcher))
+        {
+            mapping = &entry;
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+void Translator::UpdateLookupCounters(const Mapping *aMapping, uint32_t aNumProbes)
+{
+    // Only the lookups of the translated datagrams are counted, not
+    // the probes for a free port or address when allocating a mapping.
+
+    mLookupCounters.mLookups++;
+    mLookupCounters.mProbes += aNumProbes;
+    mLookupCounters.mMaxProbes = Max(mLookupCounters.mMaxProbes, aNumProbes);
+
+    if (aMapping == nullptr)
+    {
+        mLookupCounters.mMisses++;
+    }
+}
+
+void Translator::AddToIndex(const Mapping &aMapping)
+{
+    uint16_t poolIndex = mMappingPool.GetIndexOf(aMapping);
+
+    for (uint8_t key = 0; key < kNumIndexKeys; key++)
+    {
+        mIndex[key].Add(poolIndex, aMapping.GetIndexSlot(static_cast<IndexKey>(key)));
+    }
+}
+
+void Translator::RemoveFromIndex(const Mapping &aMapping)
+{
+    uint16_t poolIndex = mMappingPool.GetIndexOf(aMapping);
+
+    for (uint8_t key = 0; key < kNumIndexKeys; key++)
+    {
+        mIndex[key].Remove(poolIndex, IndexHomeSlotGetter(*this, static_cast<IndexKey>(key)));
+    }
+}
+
+void Translator::ClearIndex(void)
+{
+    for (MappingIndex &index : mIndex)
+    {
+        index.Clear();
+    }
+}
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
 uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
 {
@@ -362,6 +561,7 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
     // preventing an unknown situation on the receiver side.
 
     uint16_t port;
+    uint32_t numProbes;
 
     do
     {
@@ -376,7 +576,7 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
             port++;
         }
 
-    } while (mActiveMappings.ContainsMatching(port));
+    } while (FindIndexedMapping(kIp4Key, GetIp4IndexSlot(port), port, numProbes) != nullptr);
 
     return port;
 }
@@ -403,6 +603,7 @@ Error Translator::AllocateIp4Address(Ip4::Address &aIp4Address)
 
     Error    error = kErrorNone;
     uint32_t numberOfHosts;
+    uint32_t numProbes;
 
     numberOfHosts = mMaxHostId - mMinHostId + 1;
 
@@ -415,7 +616,8 @@ Error Translator::AllocateIp4Address(Ip4::Address &aIp4Address)
     do
     {
         GetNextIp4Address(aIp4Address);
-    } while (mActiveMappings.ContainsMatching(aIp4Address));
+    } while (FindIndexedMapping(kIp4Key, GetIp4IndexSlot(aIp4Address.mFields.m32), aIp4Address, numProbes) !=
+             nullptr);
 
 exit:
     return error;
@@ -462,6 +664,7 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
     mapping->mSrcPortOrId        = GetSourcePortOrIcmp6Id(aIp6Headers);
     mapping->mTranslatedPortOrId = AllocateSourcePort(mapping->mSrcPortOrId);
 #endif
+    AddToIndex(*mapping);
 
     LogInfo("Mapping created: %s", mapping->ToString().AsCString());
 
@@ -37,6 +37,8 @@
 #include "openthread-core-config.h"
 
 #include "common/locator.hpp"
+#include "common/num_utils.hpp"
+#include "common/open_address_index.hpp"
 #include "common/owning_list.hpp"
 #include "common/pool.hpp"
 #include "common/timer.hpp"
@@ -77,6 +79,8 @@ public:
     typedef otNat64DropReason     DropReason;     ///< Drop reason.
     typedef otNat64ErrorCounters  ErrorCounters;  ///< Error counters.
 
+    typedef otNat64MappingLookupCounters MappingLookupCounters; ///< Mapping table lookup counters.
+
     /**
      * An iterator to iterate over `AddressMapping` entries.
      */
@@ -275,6 +279,15 @@ public:
      */
     const ErrorCounters &GetErrorCounters(void) const { return mErrorCounters; }
 
+    /**
+     * Gets the NAT64 translator address mapping table lookup counters.
+     *
+     * The counters are initialized to zero when the OpenThread instance is initialized.
+     *
+     * @returns The mapping table lookup counters.
+     */
+    const MappingLookupCounters &GetMappingLookupCounters(void) const { return mLookupCounters; }
+
 private:
     // Timeouts are in milliseconds
     static constexpr uint32_t kIdleTimeout = OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
@@ -292,6 +305,22 @@ private:
     static constexpr uint16_t kMaxTranslationPort = 65535;
 #endif
 
+    // The active mappings are indexed by two open-addressing (linear
+    // probing) hash indexes holding mapping pool indexes. The
+    // `kIp6Key` index is keyed by the IPv6 source (and source port or
+    // ICMP id with port translation) for outgoing datagrams. The
+    // `kIp4Key` index is keyed by the translated port (with port
+    // translation) or by the IPv4 address for incoming datagrams.
+
+    typedef OpenAddressIndex<kPoolSize> MappingIndex;
+
+    enum IndexKey : uint8_t
+    {
+        kIp6Key,
+        kIp4Key,
+        kNumIndexKeys,
+    };
+
     static constexpr DropReason kReasonUnknown          = OT_NAT64_DROP_REASON_UNKNOWN;
     static constexpr DropReason kReasonIllegalPacket    = OT_NAT64_DROP_REASON_ILLEGAL_PACKET;
     static constexpr DropReason kReasonUnsupportedProto = OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO;
@@ -328,6 +357,7 @@ private:
 #else
         bool Matches(const Ip4::Address &aIp4Address) const { return mIp4Address == aIp4Address; }
 #endif
+        uint16_t GetIndexSlot(IndexKey aKey) const;
 
         static bool IsCounterZero(const ProtocolCounters::Counters &aCounters);
 
@@ -344,6 +374,25 @@ private:
 #endif
     };
 
+    class IndexHomeSlotGetter
+    {
+    public:
+        IndexHomeSlotGetter(const Translator &aTranslator, IndexKey aKey)
+            : mTranslator(aTranslator)
+            , mKey(aKey)
+        {
+        }
+
+        uint16_t GetHomeSlot(uint16_t aEntryIndex) const
+        {
+            return mTranslator.mMappingPool.GetEntryAt(aEntryIndex).GetIndexSlot(mKey);
+        }
+
+    private:
+        const Translator &mTranslator;
+        IndexKey          mKey;
+    };
+
     bool     IsEnabled(void) const { return mState != kStateDisabled; }
     bool     HasValidPrefixAndCidr(void) const;
     void     SetState(State aState);
@@ -353,14 +402,27 @@ private:
     void     GetNextIp4Address(Ip4::Address &aIp4Address);
     Error    AllocateIp4Address(Ip4::Address &aIp4Address);
     Mapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
+    Mapping *FindMapping(const Ip6::Headers &aIp6Headers);
+    Mapping *FindMapping(const Ip4::Headers &aIp4Headers);
+    void     AddToIndex(const Mapping &aMapping);
+    void     RemoveFromIndex(const Mapping &aMapping);
+    void     ClearIndex(void);
     void     EvictStaleMapping(void);
     void     HandleTimer(void);
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     uint16_t AllocateSourcePort(uint16_t aSrcPort);
 #endif
 
+    template <typename MatcherType>
+    Mapping *FindIndexedMapping(IndexKey aKey, uint16_t aSlot, const MatcherType &aMatcher, uint32_t &aNumProbes);
+    void     UpdateLookupCounters(const Mapping *aMapping, uint32_t aNumProbes);
+
     static uint16_t GetSourcePortOrIcmp6Id(const Ip6::Headers &aIp6Headers);
     static uint16_t GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers);
+    static uint16_t GetIp6IndexSlot(const Ip6::Address &aIp6Address, uint16_t aSrcPortOrId);
+    static uint16_t GetIp4IndexSlot(uint32_t aKey);
+    static bool     UpdatePortAndChecksum(Ip6::Headers &aIp6Headers, const Ip4::Header &aIp4Header, uint16_t aSrcPort);
+    static bool     UpdatePortAndChecksum(Ip4::Headers &aIp4Headers, const Ip6::Header &aIp6Header, uint16_t aDstPort);
 
     using TranslatorTimer = TimerMilliIn<Translator, &Translator::HandleTimer>;
 
@@ -376,6 +438,8 @@ private:
     TranslatorTimer          mTimer;
     ProtocolCounters         mCounters;
     ErrorCounters            mErrorCounters;
+    MappingLookupCounters    mLookupCounters;
+    MappingIndex             mIndex[kNumIndexKeys];
 };
 #endif // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -1093,6 +1093,7 @@ Error Client::PrepareUpdateMessage(MsgInfo &aInfo)
     aInfo.mDomainNameOffset = MsgInfo::kUnknownOffset;
     aInfo.mHostNameOffset   = MsgInfo::kUnknownOffset;
     aInfo.mRecordCount      = 0;
+    aInfo.mNameCompressor.Clear();
 
 #if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
     aInfo.mKeyInfo.SetKeyRef(Get<Crypto::Storage::KeyRefManager>().KeyRefFor(Crypto::Storage::KeyRefManager::kEcdsa));
@@ -1119,7 +1120,7 @@ Error Client::PrepareUpdateMessage(MsgInfo &aInfo)
     // Prepare Zone section
 
     aInfo.mDomainNameOffset = aInfo.mMessage->GetLength();
-    SuccessOrExit(error = Dns::Name::AppendName(mDomainName, *aInfo.mMessage));
+    SuccessOrExit(error = aInfo.mNameCompressor.AppendName(mDomainName, *aInfo.mMessage));
     SuccessOrExit(error = aInfo.mMessage->Append(Dns::Zone()));
 
     // Prepare Update section
@@ -1384,10 +1385,11 @@ Error Client::AppendServiceInstruction(Service &aService, MsgInfo &aInfo)
 
     // PTR record
 
-    // "service name labels" + (pointer to) domain name.
+    // "service name labels" + (pointer to) domain name. The name
+    // compressor replaces the service name with a pointer when it
+    // was already appended for another service of the same type.
     serviceNameOffset = aInfo.mMessage->GetLength();
-    SuccessOrExit(error = Dns::Name::AppendMultipleLabels(aService.GetName(), *aInfo.mMessage));
-    SuccessOrExit(error = Dns::Name::AppendPointerLabel(aInfo.mDomainNameOffset, *aInfo.mMessage));
+    SuccessOrExit(error = aInfo.mNameCompressor.AppendName(nullptr, aService.GetName(), mDomainName, *aInfo.mMessage));
 
     // On remove, we use "Delete an RR from an RRSet" where class is set
     // to NONE and TTL to zero (RFC 2136 - section 2.5.4).
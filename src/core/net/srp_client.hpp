@@ -1012,13 +1012,14 @@ private:
     {
         static constexpr uint16_t kUnknownOffset = 0;
 
-        OwnedPtr<Message> mMessage;
-        bool              mSingleServiceMode;
-        uint16_t          mDomainNameOffset;
-        uint16_t          mHostNameOffset;
-        uint16_t          mRecordCount;
-        uint16_t          mSigRecordOffset;
-        KeyInfo           mKeyInfo;
+        OwnedPtr<Message>   mMessage;
+        bool                mSingleServiceMode;
+        uint16_t            mDomainNameOffset;
+        uint16_t            mHostNameOffset;
+        uint16_t            mRecordCount;
+        uint16_t            mSigRecordOffset;
+        KeyInfo             mKeyInfo;
+        Dns::NameCompressor mNameCompressor;
     };
 
     Error        Start(const Ip6::SockAddr &aServerSockAddr, Requester aRequester);
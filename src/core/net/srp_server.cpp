@@ -80,6 +80,9 @@ Server::Server(Instance &aInstance)
     , mLeaseTimer(aInstance)
     , mOutstandingUpdatesTimer(aInstance)
     , mCompletedUpdateTask(aInstance)
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    , mQueuedUpdatesTask(aInstance)
+#endif
     , mServiceUpdateId(Random::NonCrypto::Generate<uint32_t>())
     , mPort(kUninitializedPort)
     , mState(kStateDisabled)
@@ -464,7 +467,7 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
     else
     {
         aHost->SetKeyLease(0);
-        IgnoreError(mHosts.Remove(*aHost));
+        RemoveHostFromList(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -499,7 +502,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
     {
@@ -507,19 +510,20 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         ExitNow(hasConflicts = true);
     }
 
-    for (const Host &host : mHosts)
+    // Verify that no allocated services (on a host with a different
+    // key) have the same instance name.
+
+    for (const Service &service : aHost.mServices)
     {
-        if (aHost.mKey == host.mKey)
-        {
-            continue;
-        }
+        const char *instanceName = service.GetInstanceName();
 
-        // Verify that no allocated services have the same instance name.
-        for (const Service &service : aHost.mServices)
+        for (const Service *existingService = FindNextServiceWithInstanceName(instanceName, nullptr);
+             existingService != nullptr;
+             existingService = FindNextServiceWithInstanceName(instanceName, existingService))
         {
-            if (host.HasService(service.GetInstanceName()))
+            if (aHost.mKey != existingService->GetHost().mKey)
             {
-                LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
+                LogWarn("Name conflict: service name %s has already been allocated", instanceName);
                 ExitNow(hasConflicts = true);
             }
         }
@@ -529,6 +533,142 @@ exit:
     return hasConflicts;
 }
 
+void Server::AddHostToList(Host &aHost)
+{
+    mHosts.Push(aHost);
+
+    mHostIndex.Add(aHost, aHost.GetFullName());
+    aHost.mIsIndexed = true;
+
+    for (Service &service : aHost.mServices)
+    {
+        AddServiceToIndex(service);
+    }
+}
+
+void Server::RemoveHostFromList(Host &aHost)
+{
+    IgnoreError(mHosts.Remove(aHost));
+
+    VerifyOrExit(aHost.mIsIndexed);
+
+    mHostIndex.Remove(aHost);
+    aHost.mIsIndexed = false;
+
+    for (Service &service : aHost.mServices)
+    {
+        RemoveServiceFromIndex(service);
+    }
+
+exit:
+    return;
+}
+
+Server::Host *Server::FindHost(const char *aFullName) { return AsNonConst(AsConst(this)->FindHost(aFullName)); }
+
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    const Host *host = mHostIndex.GetFirst(CalculateNameHash(aFullName));
+
+    while ((host != nullptr) && !host->Matches(aFullName))
+    {
+        host = HostIndex::GetNext(*host);
+    }
+
+    return host;
+}
+
+void Server::AddServiceToIndex(Service &aService)
+{
+    mServiceInstanceIndex.Add(aService, aService.GetInstanceName());
+    mServiceTypeIndex.Add(aService, aService.GetServiceName());
+}
+
+void Server::RemoveServiceFromIndex(Service &aService)
+{
+    mServiceInstanceIndex.Remove(aService);
+    mServiceTypeIndex.Remove(aService);
+}
+
+const Server::Service *Server::FindNextServiceWithInstanceName(const char    *aInstanceName,
+                                                               const Service *aPrevService) const
+{
+    // Iterates over services (of all hosts in `mHosts`, including
+    // deleted ones) matching `aInstanceName`. Start with `nullptr`
+    // as `aPrevService` to get the first one.
+
+    const Service *service;
+
+    if (aPrevService == nullptr)
+    {
+        service = mServiceInstanceIndex.GetFirst(CalculateNameHash(aInstanceName));
+    }
+    else
+    {
+        service = ServiceInstanceIndex::GetNext(*aPrevService);
+    }
+
+    while ((service != nullptr) && !service->MatchesInstanceName(aInstanceName))
+    {
+        service = ServiceInstanceIndex::GetNext(*service);
+    }
+
+    return service;
+}
+
+const Server::Service *Server::FindNextServiceWithServiceName(const char    *aServiceName,
+                                                              const Service *aPrevService) const
+{
+    // Iterates over services (of all hosts in `mHosts`, including
+    // deleted ones) with base service name `aServiceName`. Start with
+    // `nullptr` as `aPrevService` to get the first one.
+
+    const Service *service;
+
+    if (aPrevService == nullptr)
+    {
+        service = mServiceTypeIndex.GetFirst(CalculateNameHash(aServiceName));
+    }
+    else
+    {
+        service = ServiceTypeIndex::GetNext(*aPrevService);
+    }
+
+    while ((service != nullptr) && !service->MatchesServiceName(aServiceName))
+    {
+        service = ServiceTypeIndex::GetNext(*service);
+    }
+
+    return service;
+}
+
+uint32_t Server::CalculateNameHash(const char *aName)
+{
+    // Calculates a case-insensitive hash (FNV-1a) of `aName`. A
+    // trailing dot (if any) is ignored.
+
+    static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    static constexpr uint32_t kFnvPrime       = 16777619u;
+
+    uint32_t hash = kFnvOffsetBasis;
+
+    VerifyOrExit(aName != nullptr);
+
+    for (; *aName != kNullChar; aName++)
+    {
+        if ((*aName == Dns::Name::kLabelSeparatorChar) && (aName[1] == kNullChar))
+        {
+            break;
+        }
+
+        hash ^= static_cast<uint8_t>(ToLowercase(*aName));
+        hash *= kFnvPrime;
+    }
+
+exit:
+    return hash;
+}
+
 void Server::HandleServiceUpdateResult(ServiceUpdateId aId, Error aError)
 {
     UpdateMetadata *update = mOutstandingUpdates.RemoveMatching(aId);
@@ -617,7 +757,12 @@ void Server::CommitSrpUpdate(Error                    aError,
     grantedKeyLease = useShortLease ? grantedLease : aLeaseConfig.GrantKeyLease(hostKeyLease);
     grantedTtl      = aTtlConfig.GrantTtl(grantedLease, aHost.GetTtl());
 
-    existingHost = mHosts.RemoveMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
+
+    if (existingHost != nullptr)
+    {
+        RemoveHostFromList(*existingHost);
+    }
 
     LogInfo("Committing update for %s host %s", (existingHost != nullptr) ? "existing" : "new", aHost.GetFullName());
     LogInfo("    Granted lease:%lu, key-lease:%lu, ttl:%lu", ToUlong(grantedLease), ToUlong(grantedKeyLease),
@@ -638,7 +783,7 @@ void Server::CommitSrpUpdate(Error                    aError,
         ExitNow();
     }
 
-    mHosts.Push(aHost);
+    AddHostToList(aHost);
 
     for (Service &service : aHost.mServices)
     {
@@ -899,6 +1044,13 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    mQueuedUpdates.DequeueAndFreeAll();
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    mSignatureCache.Clear();
+#endif
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -1363,7 +1515,7 @@ bool Server::IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord)
            aRecord.GetTtl() == 0 && aRecord.GetLength() == 0;
 }
 
-Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const
+Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata)
 {
     Error             error = kErrorNone;
     Dns::OptRecord    optRecord;
@@ -1452,7 +1604,7 @@ Error Server::VerifySignature(const Host::Key  &aKey,
                               uint16_t          aSigOffset,
                               uint16_t          aSigRdataOffset,
                               uint16_t          aSigRdataLength,
-                              const char       *aSignerName) const
+                              const char       *aSignerName)
 {
     Error                          error;
     uint16_t                       offset = aMessage.GetOffset();
@@ -1461,6 +1613,9 @@ Error Server::VerifySignature(const Host::Key  &aKey,
     Crypto::Sha256::Hash           hash;
     Crypto::Ecdsa::P256::Signature signature;
     Message                       *signerNameMessage = nullptr;
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    Crypto::Sha256::Hash tag;
+#endif
 
     VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
 
@@ -1486,7 +1641,21 @@ Error Server::VerifySignature(const Host::Key  &aKey,
     signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
     SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
 
-    error = aKey.Verify(hash, signature);
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    SignatureCache::CalculateTag(aKey, hash, signature, tag);
+
+    if (mSignatureCache.Contains(tag))
+    {
+        LogInfo("Signature was verified before, skip verification");
+        ExitNow();
+    }
+#endif
+
+    SuccessOrExit(error = aKey.Verify(hash, signature));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    mSignatureCache.Add(tag);
+#endif
 
 exit:
     LogWarnOnError(error, "verify message signature");
@@ -1505,7 +1674,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1719,9 +1888,103 @@ void Server::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessag
 
 Error Server::ProcessMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    // If the queue is full (or the message cannot be copied), the
+    // update is dropped and the client will retransmit it. It is not
+    // processed right away, since it would then be committed ahead of
+    // the older queued updates, which may be from the same host.
+
+    return QueueUpdate(aMessage, aMessageInfo);
+#else
     return ProcessMessage(aMessage, TimerMilli::GetNow(), mTtlConfig, mLeaseConfig, &aMessageInfo);
+#endif
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+
+Error Server::QueueUpdate(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error             error     = kErrorNone;
+    uint16_t          numQueued = 0;
+    Message          *message   = nullptr;
+    Dns::UpdateHeader dnsHeader;
+    QueuedUpdateInfo  info;
+
+    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), dnsHeader));
+
+    VerifyOrExit(dnsHeader.GetType() == Dns::UpdateHeader::Type::kTypeQuery, error = kErrorDrop);
+    VerifyOrExit(dnsHeader.GetQueryType() == Dns::UpdateHeader::kQueryTypeUpdate, error = kErrorDrop);
+
+    for (const Message &queuedMessage : mQueuedUpdates)
+    {
+        Dns::UpdateHeader queuedDnsHeader;
+
+        info.ReadFrom(queuedMessage);
+        IgnoreError(queuedMessage.Read(queuedMessage.GetOffset(), queuedDnsHeader));
+
+        if ((queuedDnsHeader.GetMessageId() == dnsHeader.GetMessageId()) &&
+            info.mMessageInfo.HasSamePeerAddrAndPort(aMessageInfo))
+        {
+            // Silently drop a retransmission of an already queued
+            // SRP update request.
+            LogInfo("Drop duplicated SRP update request: MessageId=%u", dnsHeader.GetMessageId());
+            ExitNow();
+        }
+
+        numQueued++;
+    }
+
+    VerifyOrExit(numQueued < kMaxQueuedUpdates, error = kErrorNoBufs);
+
+    message = aMessage.Clone<kNoReservedHeader>();
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    info.mRxTime      = TimerMilli::GetNow();
+    info.mTtlConfig   = mTtlConfig;
+    info.mLeaseConfig = mLeaseConfig;
+    info.mMessageInfo = aMessageInfo;
+
+    SuccessOrExit(error = info.AppendTo(*message));
+
+    mQueuedUpdates.Enqueue(*message);
+    mQueuedUpdatesTask.Post();
+    message = nullptr;
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+void Server::ProcessQueuedUpdates(void)
+{
+    // Processes the first queued SRP update message. The tasklet is
+    // posted again if there are more queued messages, so that other
+    // tasks can run between processing of the queued messages.
+
+    Message         *message = mQueuedUpdates.GetHead();
+    QueuedUpdateInfo info;
+
+    VerifyOrExit(message != nullptr);
+
+    mQueuedUpdates.Dequeue(*message);
+
+    info.ReadFrom(*message);
+    info.RemoveFrom(*message);
+
+    IgnoreError(ProcessMessage(*message, info.mRxTime, info.mTtlConfig, info.mLeaseConfig, &info.mMessageInfo));
+    message->Free();
+
+    if (!mQueuedUpdates.IsEmpty())
+    {
+        mQueuedUpdatesTask.Post();
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+
 Error Server::ProcessMessage(Message                &aMessage,
                              TimeMilli               aRxTime,
                              const TtlConfig        &aTtlConfig,
@@ -2148,6 +2411,7 @@ Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     , mNext(nullptr)
     , mParsedKey(false)
     , mUseShortLeaseOption(false)
+    , mIsIndexed(false)
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     , mIsRegistered(false)
     , mIsKeyRegistered(false)
@@ -2210,6 +2474,11 @@ void Server::Host::AddService(Service &aService)
 {
     aService.mHost = this;
     mServices.Push(aService);
+
+    if (mIsIndexed)
+    {
+        Get<Server>().AddServiceToIndex(aService);
+    }
 }
 
 void Server::Host::RemoveService(Service *aService, RetainName aRetainName, NotifyMode aNotifyServiceHandler)
@@ -2249,6 +2518,11 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     if (!aRetainName)
     {
+        if (mIsIndexed)
+        {
+            server.RemoveServiceFromIndex(*aService);
+        }
+
         IgnoreError(mServices.Remove(*aService));
         aService->Free();
     }
@@ -2301,6 +2575,46 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::SignatureCache
+
+void Server::SignatureCache::Clear(void)
+{
+    mTags.Clear();
+    mOldestIndex = 0;
+}
+
+void Server::SignatureCache::Add(const Crypto::Sha256::Hash &aTag)
+{
+    if (mTags.IsFull())
+    {
+        mTags[mOldestIndex] = aTag;
+        mOldestIndex        = (mOldestIndex + 1) % kSize;
+    }
+    else
+    {
+        IgnoreError(mTags.PushBack(aTag));
+    }
+}
+
+void Server::SignatureCache::CalculateTag(const Host::Key                      &aKey,
+                                          const Crypto::Sha256::Hash           &aHash,
+                                          const Crypto::Ecdsa::P256::Signature &aSignature,
+                                          Crypto::Sha256::Hash                 &aTag)
+{
+    Crypto::Sha256 sha256;
+
+    sha256.Start();
+    sha256.Update(aKey);
+    sha256.Update(aHash);
+    sha256.Update(aSignature);
+    sha256.Finish(aTag);
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::UpdateMetadata
 
@@ -64,13 +64,16 @@
 #include "common/heap_string.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
+#include "common/message.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/retain_ptr.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/dnssd.hpp"
 #include "net/ip6.hpp"
@@ -136,6 +139,17 @@ class Server : public InstanceLocator, private NonCopyable
     static constexpr Dnssd::RequestId kInvalidRequestId = 0;
 #endif
 
+    template <typename EntryType> struct IndexLink
+    {
+        // Chains an entry (`Host` or `Service`) in a bucket of a
+        // `NameIndex` and tracks the hash of its indexed name.
+
+        EntryType *mNext;
+        uint32_t   mHash;
+    };
+
+    template <typename EntryType, IndexLink<EntryType> EntryType::*kLink> class NameIndex;
+
 public:
     static constexpr uint16_t kUdpPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN; ///< The reserved min port.
     static constexpr uint16_t kUdpPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX; ///< The reserved max port.
@@ -419,6 +433,8 @@ public:
         }
 
         Service                  *mNext;
+        IndexLink<Service>        mInstanceIndexLink;
+        IndexLink<Service>        mTypeIndexLink;
         Heap::String              mInstanceName;
         Heap::String              mInstanceLabel;
         Heap::String              mServiceName;
@@ -544,12 +560,14 @@ public:
         Error          AddIp6Address(const Ip6::Address &aIp6Address);
 
         Host                     *mNext;
+        IndexLink<Host>           mIndexLink;
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
         Key                       mKey;
         LinkedList<Service>       mServices;
         bool                      mParsedKey : 1;
         bool                      mUseShortLeaseOption : 1; // Use short lease option (lease only 4 bytes).
+        bool                      mIsIndexed : 1;           // Host is in `mHosts` and its services are indexed.
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
         bool                  mIsRegistered : 1;
         bool                  mIsKeyRegistered : 1;
@@ -848,6 +866,10 @@ private:
     static constexpr uint16_t kUninitializedPort      = 0;
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    static constexpr uint16_t kMaxQueuedUpdates = OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH;
+#endif
+
     // Metadata for a received SRP Update message.
     struct MessageMetadata
     {
@@ -901,6 +923,120 @@ private:
         bool              mIsDirectRxFromClient;
     };
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    // Metadata appended to a queued SRP Update message.
+    struct QueuedUpdateInfo : public Message::FooterData<QueuedUpdateInfo>
+    {
+        TimeMilli        mRxTime;
+        TtlConfig        mTtlConfig;
+        LeaseConfig      mLeaseConfig;
+        Ip6::MessageInfo mMessageInfo;
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    class SignatureCache : private NonCopyable
+    {
+        // Tracks recently verified SIG(0) signatures. Each entry is a
+        // tag (SHA-256 hash) calculated over the host key, the hash of
+        // the signed data, and the signature. When full, the oldest
+        // entry is replaced.
+
+    public:
+        SignatureCache(void) { Clear(); }
+
+        void Clear(void);
+        bool Contains(const Crypto::Sha256::Hash &aTag) const { return mTags.Contains(aTag); }
+        void Add(const Crypto::Sha256::Hash &aTag);
+
+        static void CalculateTag(const Host::Key                      &aKey,
+                                 const Crypto::Sha256::Hash           &aHash,
+                                 const Crypto::Ecdsa::P256::Signature &aSignature,
+                                 Crypto::Sha256::Hash                 &aTag);
+
+    private:
+        static constexpr uint8_t kSize = OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE;
+
+        Array<Crypto::Sha256::Hash, kSize> mTags;
+        uint8_t                            mOldestIndex;
+    };
+#endif
+
+    template <typename EntryType, IndexLink<EntryType> EntryType::*kLink> class NameIndex : private NonCopyable
+    {
+        // Indexes entries by the hash of a name. `kLink` specifies
+        // the `IndexLink` member of `EntryType` which is used to
+        // chain the entry in a bucket, so the same entry can be
+        // added in more than one index (e.g., a `Service` is indexed
+        // by both its instance name and its service name).
+        //
+        // Entries with the same hash are returned by `GetFirst()`
+        // and `GetNext()`. The caller is responsible for checking
+        // the entry name (hash collisions are possible).
+
+    public:
+        NameIndex(void) { Clear(); }
+
+        void Clear(void) { ClearAllBytes(mBuckets); }
+
+        void Add(EntryType &aEntry, const char *aName)
+        {
+            IndexLink<EntryType> &link   = aEntry.*kLink;
+            EntryType          *&bucket = GetBucket(link.mHash = CalculateNameHash(aName));
+
+            link.mNext = bucket;
+            bucket     = &aEntry;
+        }
+
+        void Remove(EntryType &aEntry)
+        {
+            IndexLink<EntryType> &link = aEntry.*kLink;
+
+            for (EntryType **entryPtr = &GetBucket(link.mHash); *entryPtr != nullptr;
+                 entryPtr             = &((*entryPtr)->*kLink).mNext)
+            {
+                if (*entryPtr == &aEntry)
+                {
+                    *entryPtr  = link.mNext;
+                    link.mNext = nullptr;
+                    break;
+                }
+            }
+        }
+
+        EntryType *GetFirst(uint32_t aHash) const { return FindInChain(mBuckets[aHash % kNumBuckets], aHash); }
+
+        static EntryType *GetNext(const EntryType &aEntry)
+        {
+            const IndexLink<EntryType> &link = aEntry.*kLink;
+
+            return FindInChain(link.mNext, link.mHash);
+        }
+
+    private:
+        static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE;
+
+        static_assert(kNumBuckets > 0, "OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE must be non-zero");
+
+        static EntryType *FindInChain(EntryType *aEntry, uint32_t aHash)
+        {
+            while ((aEntry != nullptr) && ((aEntry->*kLink).mHash != aHash))
+            {
+                aEntry = (aEntry->*kLink).mNext;
+            }
+
+            return aEntry;
+        }
+
+        EntryType *&GetBucket(uint32_t aHash) { return mBuckets[aHash % kNumBuckets]; }
+
+        EntryType *mBuckets[kNumBuckets];
+    };
+
+    using HostIndex            = NameIndex<Host, &Host::mIndexLink>;
+    using ServiceInstanceIndex = NameIndex<Service, &Service::mInstanceIndexLink>;
+    using ServiceTypeIndex     = NameIndex<Service, &Service::mTypeIndexLink>;
+
     void              Enable(void);
     void              Disable(void);
     void              Start(void);
@@ -943,14 +1079,14 @@ private:
                          const Ip6::MessageInfo *aMessageInfo);
     void  ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata);
     Error ProcessUpdateSection(Host &aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
+    Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata);
     Error VerifySignature(const Host::Key  &aKey,
                           const Message    &aMessage,
                           Dns::UpdateHeader aDnsHeader,
                           uint16_t          aSigOffset,
                           uint16_t          aSigRdataOffset,
                           uint16_t          aSigRdataLength,
-                          const char       *aSignerName) const;
+                          const char       *aSignerName);
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
                                             const Message         &aMessage,
@@ -965,6 +1101,17 @@ private:
     void        HandleUpdate(Host &aHost, const MessageMetadata &aMetadata);
     void        RemoveHost(Host *aHost, RetainName aRetainName);
     bool        HasNameConflictsWith(Host &aHost) const;
+    void        AddHostToList(Host &aHost);
+    void        RemoveHostFromList(Host &aHost);
+    Host       *FindHost(const char *aFullName);
+    const Host *FindHost(const char *aFullName) const;
+    void        AddServiceToIndex(Service &aService);
+    void        RemoveServiceFromIndex(Service &aService);
+
+    const Service *FindNextServiceWithInstanceName(const char *aInstanceName, const Service *aPrevService) const;
+    const Service *FindNextServiceWithServiceName(const char *aServiceName, const Service *aPrevService) const;
+
+    static uint32_t CalculateNameHash(const char *aName);
     void        SendResponse(const Dns::UpdateHeader    &aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
                              const Ip6::MessageInfo     &aMessageInfo);
@@ -978,6 +1125,10 @@ private:
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
     void        HandleOutstandingUpdatesTimer(void);
     void        ProcessCompletedUpdates(void);
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    Error QueueUpdate(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void  ProcessQueuedUpdates(void);
+#endif
 
     const UpdateMetadata *FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
     static const char    *AddressModeToString(AddressMode aMode);
@@ -989,6 +1140,9 @@ private:
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
     using CompletedUpdatesTask = TaskletIn<Server, &Server::ProcessCompletedUpdates>;
     using ServerSocket         = Ip6::Udp::SocketIn<Server, &Server::HandleUdpReceive>;
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    using QueuedUpdatesTask = TaskletIn<Server, &Server::ProcessQueuedUpdates>;
+#endif
 
     ServerSocket mSocket;
 
@@ -999,14 +1153,25 @@ private:
     TtlConfig   mTtlConfig;
     LeaseConfig mLeaseConfig;
 
-    LinkedList<Host> mHosts;
-    LeaseTimer       mLeaseTimer;
+    LinkedList<Host>     mHosts;
+    HostIndex            mHostIndex;
+    ServiceInstanceIndex mServiceInstanceIndex;
+    ServiceTypeIndex     mServiceTypeIndex;
+    LeaseTimer           mLeaseTimer;
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
     LinkedList<UpdateMetadata> mCompletedUpdates;
     CompletedUpdatesTask       mCompletedUpdateTask;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    MessageQueue      mQueuedUpdates;
+    QueuedUpdatesTask mQueuedUpdatesTask;
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_SIGNATURE_CACHE_SIZE > 0
+    SignatureCache mSignatureCache;
+#endif
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
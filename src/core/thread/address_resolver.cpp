@@ -43,10 +43,16 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+    , mCachedList(kCachedListId)
+    , mSnoopedList(kSnoopedListId)
+    , mQueryList(kQueryListId)
+    , mQueryRetryList(kQueryRetryListId)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    ClearIndex();
+    mAddressCacheCounters.Clear();
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -71,6 +77,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearIndex();
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -194,20 +202,82 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    // The EID hash index locates the entry (if any). The entry itself
+    // records its list and previous entry (needed to move or remove
+    // the entry while preserving the LRU order of the lists).
 
-    for (CacheEntryList *list : lists)
+    CacheEntry *entry = FindIndexedCacheEntry(aEid);
+
+    VerifyOrExit(entry != nullptr);
+
+    aList      = &GetCacheEntryList(entry->GetListId());
+    aPrevEntry = entry->GetPrev();
+
+exit:
+    return entry;
+}
+
+AddressResolver::CacheEntryList &AddressResolver::GetCacheEntryList(ListId aListId)
+{
+    CacheEntryList *list = &mCachedList;
+
+    switch (aListId)
     {
-        aList = list;
-        entry = aList->FindMatchingWithPrev(aPrevEntry, aEid);
-        VerifyOrExit(entry == nullptr);
+    case kCachedListId:
+        break;
+    case kSnoopedListId:
+        list = &mSnoopedList;
+        break;
+    case kQueryListId:
+        list = &mQueryList;
+        break;
+    case kQueryRetryListId:
+        list = &mQueryRetryList;
+        break;
+    }
+
+    return *list;
+}
+
+uint16_t AddressResolver::GetIndexSlot(const Ip6::Address &aEid)
+{
+    IndexHasher hasher;
+
+    hasher.Mix(aEid.mFields.m32);
+
+    return CacheIndex::GetHomeSlot(hasher.GetFinalizedHash());
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindIndexedCacheEntry(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t slot = GetIndexSlot(aEid); mIndex.HasEntryAt(slot); slot = CacheIndex::GetNextSlot(slot))
+    {
+        CacheEntry &cur = mCacheEntryPool.GetEntryAt(mIndex.GetEntryAt(slot));
+
+        if (cur.Matches(aEid))
+        {
+            entry = &cur;
+            break;
+        }
     }
 
-exit:
     return entry;
 }
 
+void AddressResolver::AddToIndex(const CacheEntry &aEntry)
+{
+    mIndex.Add(mCacheEntryPool.GetIndexOf(aEntry), GetIndexSlot(aEntry.GetTarget()));
+}
+
+void AddressResolver::RemoveFromIndex(const CacheEntry &aEntry)
+{
+    mIndex.Remove(mCacheEntryPool.GetIndexOf(aEntry), IndexHomeSlotGetter(*this));
+}
+
+void AddressResolver::ClearIndex(void) { mIndex.Clear(); }
+
 void AddressResolver::RemoveEntryForAddress(const Ip6::Address &aEid) { Remove(aEid, kReasonRemovingEid); }
 
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
@@ -314,6 +384,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -403,6 +474,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid, uint16_t
 
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
+    AddToIndex(*entry);
 
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
     {
@@ -427,24 +499,11 @@ exit:
 
 void AddressResolver::RestartAddressQueries(void)
 {
-    CacheEntry *tail;
-
     // We move all entries from `mQueryRetryList` at the tail of
     // `mQueryList` and then (re)send Address Query for all entries in
     // the updated `mQueryList`.
 
-    tail = mQueryList.GetTail();
-
-    if (tail == nullptr)
-    {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
-    }
-    else
-    {
-        tail->SetNext(mQueryRetryList.GetHead());
-    }
-
-    mQueryRetryList.Clear();
+    mQueryRetryList.MoveAllToTail(mQueryList);
 
     for (CacheEntry &entry : mQueryList)
     {
@@ -499,6 +558,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
         if (!isFresh && (Get<RouterTable>().GetNextHop(entry->GetRloc16()) == Mle::kInvalidRloc16))
         {
+            RemoveFromIndex(*entry);
             mCacheEntryPool.Free(*entry);
             entry = nullptr;
         }
@@ -514,10 +574,13 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
             mCachedList.Push(*entry);
             aRloc16 = entry->GetRloc16();
+            mAddressCacheCounters.mHits++;
             ExitNow();
         }
     }
 
+    mAddressCacheCounters.mMisses++;
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -534,6 +597,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
         entry->SetRloc16(Mle::kInvalidRloc16);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        AddToIndex(*entry);
         list = nullptr;
     }
 
@@ -563,7 +627,12 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    if (error != kErrorNone)
+    {
+        RemoveFromIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
@@ -1072,29 +1141,104 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
-    mNextIndex        = kNoNextIndex;
+    mNextIndex        = kNoIndex;
+    mPrevIndex        = kNoIndex;
+    mListId           = kCachedListId;
     mFreshnessTimeout = 0;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return (mNextIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
 const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) const
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return (mNextIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
-    VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
+    VerifyOrExit(aEntry != nullptr, mNextIndex = kNoIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
 exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+void AddressResolver::CacheEntry::SetPrev(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mPrevIndex = kNoIndex);
+    mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
+{
+    if (GetHead() != nullptr)
+    {
+        GetHead()->SetPrev(&aEntry);
+    }
+
+    aEntry.SetPrev(nullptr);
+    aEntry.SetListId(mListId);
+    LinkedList<CacheEntry>::Push(aEntry);
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::Pop(void) { return PopAfter(nullptr); }
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::PopAfter(CacheEntry *aPrevEntry)
+{
+    CacheEntry *entry = LinkedList<CacheEntry>::PopAfter(aPrevEntry);
+    CacheEntry *next  = (aPrevEntry == nullptr) ? GetHead() : aPrevEntry->GetNext();
+
+    if ((entry != nullptr) && (next != nullptr))
+    {
+        next->SetPrev(aPrevEntry);
+    }
+
+    return entry;
+}
+
+void AddressResolver::CacheEntryList::MoveAllToTail(CacheEntryList &aToList)
+{
+    CacheEntry *tail = aToList.GetTail();
+    CacheEntry *head = GetHead();
+
+    VerifyOrExit(head != nullptr);
+
+    for (CacheEntry &entry : *this)
+    {
+        entry.SetListId(aToList.mListId);
+    }
+
+    head->SetPrev(tail);
+
+    if (tail == nullptr)
+    {
+        aToList.SetHead(head);
+    }
+    else
+    {
+        tail->SetNext(head);
+    }
+
+    Clear();
+
+exit:
+    return;
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -43,6 +43,8 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/num_utils.hpp"
+#include "common/open_address_index.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
@@ -105,6 +107,13 @@ public:
         };
     };
 
+    /**
+     * Represents the EID cache lookup counters.
+     */
+    class AddressCacheCounters : public otAddressCacheCounters, public Clearable<AddressCacheCounters>
+    {
+    };
+
     /**
      * Initializes the object.
      */
@@ -205,6 +214,18 @@ public:
      */
     void RestartAddressQueries(void);
 
+    /**
+     * Gets the EID cache lookup counters.
+     *
+     * @returns A reference to the EID cache lookup counters.
+     */
+    const AddressCacheCounters &GetAddressCacheCounters(void) const { return mAddressCacheCounters; }
+
+    /**
+     * Resets the EID cache lookup counters.
+     */
+    void ResetAddressCacheCounters(void) { mAddressCacheCounters.Clear(); }
+
     /**
      * Sends an Address Notification (ADDR_NTF.ans) message.
      *
@@ -241,6 +262,18 @@ private:
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
 
+    // The cache entries are indexed by their EID, holding pool indexes.
+
+    typedef OpenAddressIndex<kCacheEntries> CacheIndex;
+
+    enum ListId : uint8_t
+    {
+        kCachedListId,
+        kSnoopedListId,
+        kQueryListId,
+        kQueryRetryListId,
+    };
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -250,6 +283,12 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+        CacheEntry *GetPrev(void);
+        void        SetPrev(CacheEntry *aEntry);
+
+        ListId GetListId(void) const { return static_cast<ListId>(mListId); }
+        void   SetListId(ListId aListId) { mListId = aListId; }
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -285,16 +324,18 @@ private:
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
     private:
-        static constexpr uint16_t kNoNextIndex          = 0x3fff;     // `mNextIndex` value when at end of list.
+        static constexpr uint16_t kNoIndex              = 0x3fff;     // `mNext/PrevIndex` value at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
         static constexpr uint8_t  kFreshnessTimeout     = 3;
 
-        static_assert(kCacheEntries < kNoNextIndex, "kCacheEntries is too large and does not fit in 14 bit index");
+        static_assert(kCacheEntries < kNoIndex, "kCacheEntries is too large and does not fit in 14 bit index");
 
         Ip6::Address mTarget;
         uint16_t     mRloc16;
         uint16_t     mNextIndex : 14;
-        uint8_t      mFreshnessTimeout : 2;
+        uint16_t     mListId : 2;
+        uint16_t     mPrevIndex : 14;
+        uint16_t     mFreshnessTimeout : 2;
 
         union
         {
@@ -317,8 +358,48 @@ private:
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
 
-    class CacheEntryList : public LinkedList<CacheEntry>
+    // The lists are doubly linked (using `mPrevIndex`) and every entry
+    // records the list it is in, so an entry found from the index can
+    // be moved or removed without walking any list.
+
+    class CacheEntryList : private LinkedList<CacheEntry>
     {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mListId(aListId)
+        {
+        }
+
+        using LinkedList<CacheEntry>::GetHead;
+        using LinkedList<CacheEntry>::GetTail;
+        using LinkedList<CacheEntry>::IsEmpty;
+        using LinkedList<CacheEntry>::begin;
+        using LinkedList<CacheEntry>::end;
+
+        void        Push(CacheEntry &aEntry);
+        CacheEntry *Pop(void);
+        CacheEntry *PopAfter(CacheEntry *aPrevEntry);
+        void        MoveAllToTail(CacheEntryList &aToList);
+
+    private:
+        ListId mListId;
+    };
+
+    class IndexHomeSlotGetter
+    {
+    public:
+        explicit IndexHomeSlotGetter(const AddressResolver &aResolver)
+            : mResolver(aResolver)
+        {
+        }
+
+        uint16_t GetHomeSlot(uint16_t aEntryIndex) const
+        {
+            return GetIndexSlot(mResolver.mCacheEntryPool.GetEntryAt(aEntryIndex).GetTarget());
+        }
+
+    private:
+        const AddressResolver &mResolver;
     };
 
     enum EntryChange : uint8_t
@@ -341,11 +422,16 @@ private:
     };
 
     CacheEntryPool &GetCacheEntryPool(void) { return mCacheEntryPool; }
+    CacheEntryList &GetCacheEntryList(ListId aListId);
 
     Error       Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool aAllowAddressQuery);
     void        Remove(uint16_t aRloc16, bool aMatchRouterId);
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
+    CacheEntry *FindIndexedCacheEntry(const Ip6::Address &aEid);
+    void        AddToIndex(const CacheEntry &aEntry);
+    void        RemoveFromIndex(const CacheEntry &aEntry);
+    void        ClearIndex(void);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, uint16_t aRloc16);
@@ -378,18 +464,21 @@ private:
     const char *ListToString(const CacheEntryList *aList) const;
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
+    static uint16_t                     GetIndexSlot(const Ip6::Address &aEid);
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
     static const char *EntryChangeToString(EntryChange aChange);
     static const char *ReasonToString(Reason aReason);
 #endif
 
-    CacheEntryPool     mCacheEntryPool;
-    CacheEntryList     mCachedList;
-    CacheEntryList     mSnoopedList;
-    CacheEntryList     mQueryList;
-    CacheEntryList     mQueryRetryList;
-    Ip6::Icmp::Handler mIcmpHandler;
+    CacheEntryPool       mCacheEntryPool;
+    CacheEntryList       mCachedList;
+    CacheEntryList       mSnoopedList;
+    CacheEntryList       mQueryList;
+    CacheEntryList       mQueryRetryList;
+    CacheIndex           mIndex;
+    AddressCacheCounters mAddressCacheCounters;
+    Ip6::Icmp::Handler   mIcmpHandler;
 
 #endif // OPENTHREAD_FTD
 };
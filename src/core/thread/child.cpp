@@ -78,6 +78,7 @@ void Child::Clear(void)
 {
     Instance &instance = GetInstance();
 
+    RemoveFromChildTableIndex();
     ClearAllBytes(*this);
     Init(instance);
 }
@@ -86,6 +87,9 @@ void Child::ClearIp6Addresses(void)
 {
     mMeshLocalIid.Clear();
     mIp6Addresses.Clear();
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    mIp6AddressFilter = 0;
+#endif
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     mMlrRegisteredSet.Clear();
 #endif
@@ -163,7 +167,11 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     }
 
     VerifyOrExit(!mIp6Addresses.ContainsMatching(aAddress), error = kErrorAlready);
-    error = mIp6Addresses.PushBack(aAddress);
+    SuccessOrExit(error = mIp6Addresses.PushBack(aAddress));
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    mIp6AddressFilter |= GetIp6AddressFilterBit(aAddress);
+#endif
 
 exit:
     return error;
@@ -205,6 +213,10 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     mIp6Addresses.Remove(*entry);
     error = kErrorNone;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    UpdateIp6AddressFilter();
+#endif
+
 exit:
     return error;
 }
@@ -221,12 +233,41 @@ bool Child::HasIp6Address(const Ip6::Address &aAddress) const
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    VerifyOrExit(mIp6AddressFilter & GetIp6AddressFilterBit(aAddress));
+#endif
+
     hasAddress = mIp6Addresses.ContainsMatching(aAddress);
 
 exit:
     return hasAddress;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+uint32_t Child::GetIp6AddressFilterBit(const Ip6::Address &aAddress)
+{
+    // Uses the well-mixed upper five bits of the hash as the bit number.
+
+    IndexHasher hasher;
+
+    hasher.Mix(aAddress.mFields.m32);
+
+    return static_cast<uint32_t>(1) << (hasher.GetHash() >> 27);
+}
+
+void Child::UpdateIp6AddressFilter(void)
+{
+    mIp6AddressFilter = 0;
+
+    for (const Ip6::Address &address : mIp6Addresses)
+    {
+        mIp6AddressFilter |= GetIp6AddressFilterBit(address);
+    }
+}
+
+#endif
+
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
 
 bool Child::HasMlrRegisteredAddress(const Ip6::Address &aAddress) const
@@ -333,10 +333,23 @@ public:
 private:
     typedef BitSet<kNumIp6Addresses> ChildIp6AddressSet;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // `mIp6AddressFilter` has a bit set for every address in
+    // `mIp6Addresses` (selected by `GetIp6AddressFilterBit()`) so
+    // that most non-matching addresses are rejected by a single
+    // bit check without comparing against every entry.
+
+    static uint32_t GetIp6AddressFilterBit(const Ip6::Address &aAddress);
+    void            UpdateIp6AddressFilter(void);
+#endif
+
     uint32_t mTimeout;
 
     Ip6::InterfaceIdentifier mMeshLocalIid;
     Ip6AddressArray          mIp6Addresses;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    uint32_t mIp6AddressFilter;
+#endif
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     ChildIp6AddressSet mMlrRegisteredSet;
 #endif
@@ -84,6 +84,13 @@ ChildTable::ChildTable(Instance &aInstance)
 #endif
     , mNextChildId(Mle::kMaxChildId)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    for (ChildIndex &index : mIndex)
+    {
+        index.Clear();
+    }
+#endif
+
     mChildren.SetLength(kMaxChildren);
 
     for (Child &child : mChildren)
@@ -136,9 +143,128 @@ uint16_t ChildTable::AllocateNewChildRloc16(void)
 
 const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (CanUseIndex(aMatcher))
+    {
+        return FindIndexedChild((aMatcher.GetShortAddress() != Mac::kShortAddrInvalid) ? kRloc16Key : kExtAddressKey,
+                                aMatcher);
+    }
+#endif
+
     return mChildren.FindMatching(aMatcher);
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+bool ChildTable::CanUseIndex(const Child::AddressMatcher &aMatcher)
+{
+    // The indexes only track children which are not in `kStateInvalid`
+    // so they can be used when the matcher specifies an address and
+    // its state filter never accepts an invalid child.
+
+    bool canUse = false;
+
+    VerifyOrExit((aMatcher.GetShortAddress() != Mac::kShortAddrInvalid) || (aMatcher.GetExtAddress() != nullptr));
+
+    switch (aMatcher.GetStateFilter())
+    {
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        break;
+    default:
+        canUse = true;
+        break;
+    }
+
+exit:
+    return canUse;
+}
+
+uint16_t ChildTable::GetIndexSlot(uint16_t aRloc16) { return ChildIndex::GetHomeSlot(Mle::ChildIdFromRloc16(aRloc16)); }
+
+uint16_t ChildTable::GetIndexSlot(const Mac::ExtAddress &aExtAddress)
+{
+    IndexHasher hasher;
+
+    hasher.Mix(aExtAddress.m8);
+
+    return ChildIndex::GetHomeSlot(hasher.GetFinalizedHash());
+}
+
+uint16_t ChildTable::GetIndexSlot(IndexKey aKey, const Child &aChild) const
+{
+    return (aKey == kRloc16Key) ? GetIndexSlot(aChild.GetRloc16()) : GetIndexSlot(aChild.GetExtAddress());
+}
+
+const Child *ChildTable::FindIndexedChild(IndexKey aKey, const Child::AddressMatcher &aMatcher) const
+{
+    // Multiple children may share the same address (e.g., a child
+    // re-attaching while its previous entry is still being removed).
+    // The entry with the lowest child index is returned to match the
+    // behavior of a linear search over the table.
+
+    const ChildIndex &index = mIndex[aKey];
+    const Child      *match = nullptr;
+    uint16_t          slot;
+
+    slot = (aKey == kRloc16Key) ? GetIndexSlot(aMatcher.GetShortAddress()) : GetIndexSlot(*aMatcher.GetExtAddress());
+
+    for (; index.HasEntryAt(slot); slot = ChildIndex::GetNextSlot(slot))
+    {
+        const Child &child = mChildren.GetArrayBuffer()[index.GetEntryAt(slot)];
+
+        if (aMatcher.Matches(child) && ((match == nullptr) || (&child < match)))
+        {
+            match = &child;
+        }
+    }
+
+    return match;
+}
+
+void ChildTable::AddToIndex(const Neighbor &aNeighbor)
+{
+    uint16_t childIndex;
+
+    VerifyOrExit(mChildren.IsInArrayBuffer(&aNeighbor) && !aNeighbor.IsStateInvalid());
+
+    childIndex = mChildren.IndexOf(static_cast<const Child &>(aNeighbor));
+
+    AddToIndex(kRloc16Key, childIndex);
+    AddToIndex(kExtAddressKey, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromIndex(const Neighbor &aNeighbor)
+{
+    uint16_t childIndex;
+
+    VerifyOrExit(mChildren.IsInArrayBuffer(&aNeighbor) && !aNeighbor.IsStateInvalid());
+
+    childIndex = mChildren.IndexOf(static_cast<const Child &>(aNeighbor));
+
+    RemoveFromIndex(kRloc16Key, childIndex);
+    RemoveFromIndex(kExtAddressKey, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::AddToIndex(IndexKey aKey, uint16_t aChildIndex)
+{
+    mIndex[aKey].Add(aChildIndex, GetIndexSlot(aKey, mChildren.GetArrayBuffer()[aChildIndex]));
+}
+
+void ChildTable::RemoveFromIndex(IndexKey aKey, uint16_t aChildIndex)
+{
+    mIndex[aKey].Remove(aChildIndex, IndexHomeSlotGetter(*this, aKey));
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
     return FindChild(Child::AddressMatcher(aRloc16, aFilter));
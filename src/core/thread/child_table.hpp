@@ -43,6 +43,8 @@
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/num_utils.hpp"
+#include "common/open_address_index.hpp"
 #include "thread/child.hpp"
 
 namespace ot {
@@ -53,6 +55,9 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    friend class Neighbor;
+#endif
     class IteratorBuilder;
 
 public:
@@ -369,8 +374,59 @@ private:
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // Children in any state other than `kStateInvalid` are tracked
+    // in two open-addressing (linear probing) hash indexes: one keyed
+    // by the Child ID of the RLOC16 and one keyed by the Extended
+    // Address, both holding child table indexes. `Neighbor` updates the indexes whenever the state, RLOC16 or
+    // Extended Address of a child changes.
+
+    enum IndexKey : uint8_t
+    {
+        kRloc16Key,
+        kExtAddressKey,
+    };
+
+    static constexpr uint8_t kNumIndexKeys = 2;
+
+    typedef OpenAddressIndex<kMaxChildren> ChildIndex;
+
+    class IndexHomeSlotGetter
+    {
+    public:
+        IndexHomeSlotGetter(const ChildTable &aChildTable, IndexKey aKey)
+            : mChildTable(aChildTable)
+            , mKey(aKey)
+        {
+        }
+
+        uint16_t GetHomeSlot(uint16_t aChildIndex) const
+        {
+            return mChildTable.GetIndexSlot(mKey, mChildTable.mChildren.GetArrayBuffer()[aChildIndex]);
+        }
+
+    private:
+        const ChildTable &mChildTable;
+        IndexKey          mKey;
+    };
+
+    void         AddToIndex(const Neighbor &aNeighbor);
+    void         RemoveFromIndex(const Neighbor &aNeighbor);
+    void         AddToIndex(IndexKey aKey, uint16_t aChildIndex);
+    void         RemoveFromIndex(IndexKey aKey, uint16_t aChildIndex);
+    const Child *FindIndexedChild(IndexKey aKey, const Child::AddressMatcher &aMatcher) const;
+    uint16_t     GetIndexSlot(IndexKey aKey, const Child &aChild) const;
+
+    static uint16_t GetIndexSlot(uint16_t aRloc16);
+    static uint16_t GetIndexSlot(const Mac::ExtAddress &aExtAddress);
+    static bool     CanUseIndex(const Child::AddressMatcher &aMatcher);
+#endif
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMaxChildIpAddresses;
+#endif
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    ChildIndex mIndex[kNumIndexKeys];
 #endif
     Array<Child, kMaxChildren, uint16_t> mChildren;
     uint16_t                             mNextChildId;
@@ -224,7 +224,7 @@ void DiscoverScanner::HandleDiscoveryRequestFrameTxDone(Message &aMessage, Error
             // is not dequeued and freed by `MeshForwarder` and is ready for
             // the next scan channel. Also pause message tx on `MeshForwarder`
             // while listening to receive Discovery Responses.
-            aMessage.SetDirectTransmission();
+            Get<MeshForwarder>().SetDirectTransmission(aMessage);
             aMessage.SetTimestampToNow();
             aMessage.RegisterTxCallback(HandleDiscoveryRequestFrameTxDone, this);
             Get<MeshForwarder>().PauseMessageTransmissions();
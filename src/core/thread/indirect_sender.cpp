@@ -139,11 +139,14 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    for (PriorityQueue &queue : Get<MeshForwarder>().mSendQueues)
     {
-        message.GetIndirectTxChildMask().Remove(Get<ChildTable>().GetChildIndex(aChild));
+        for (Message &message : queue)
+        {
+            message.GetIndirectTxChildMask().Remove(Get<ChildTable>().GetChildIndex(aChild));
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        }
     }
 
     aChild.SetIndirectMessage(nullptr);
@@ -160,14 +163,35 @@ exit:
 
 const Message *IndirectSender::FindQueuedMessageForSleepyChild(const Child &aChild, MessageChecker aChecker) const
 {
+    // A message for the child may be in any of the send queues, e.g.,
+    // a multicast message can be pending both direct and indirect tx.
+    // The first match in each queue is found and the one with the
+    // highest priority (or the earliest timestamp on equal priority)
+    // is selected.
+
     const Message *match      = nullptr;
     uint16_t       childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-    for (const Message &message : Get<MeshForwarder>().mSendQueue)
+    for (const PriorityQueue &queue : Get<MeshForwarder>().mSendQueues)
     {
-        if (message.GetIndirectTxChildMask().Has(childIndex) && aChecker(message))
+        for (const Message &message : queue)
         {
-            match = &message;
+            if ((match != nullptr) && (message.GetPriority() < match->GetPriority()))
+            {
+                break;
+            }
+
+            if (!message.GetIndirectTxChildMask().Has(childIndex) || !aChecker(message))
+            {
+                continue;
+            }
+
+            if ((match == nullptr) || (message.GetPriority() > match->GetPriority()) ||
+                (message.GetTimestamp() < match->GetTimestamp()))
+            {
+                match = &message;
+            }
+
             break;
         }
     }
@@ -199,13 +223,16 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-        for (Message &message : Get<MeshForwarder>().mSendQueue)
+        for (PriorityQueue &queue : Get<MeshForwarder>().mSendQueues)
         {
-            if (message.GetIndirectTxChildMask().Has(childIndex))
+            for (Message &message : queue)
             {
-                message.GetIndirectTxChildMask().Remove(childIndex);
-                message.SetDirectTransmission();
-                message.SetTimestampToNow();
+                if (message.GetIndirectTxChildMask().Has(childIndex))
+                {
+                    message.GetIndirectTxChildMask().Remove(childIndex);
+                    message.SetTimestampToNow();
+                    Get<MeshForwarder>().SetDirectTransmission(message);
+                }
             }
         }
 
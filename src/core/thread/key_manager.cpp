@@ -188,6 +188,10 @@ KeyManager::KeyManager(Instance &aInstance)
 #endif
 
     mMacFrameCounters.Reset();
+
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    mKeyCacheCounters.Clear();
+#endif
 }
 
 void KeyManager::Init(void)
@@ -348,7 +352,17 @@ void KeyManager::UpdateKeyMaterial(void)
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, Mac::DetermineKeyIndexFor(mKeySequence),
                                      prevHashKeys.GetMacKey(), hashKeys.GetMacKey(), nextHashKeys.GetMacKey());
+
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+        mAdjacentMleKeys[kPrevKeySequence].SetFrom(prevHashKeys.GetMleKey());
+        mAdjacentMleKeys[kNextKeySequence].SetFrom(nextHashKeys.GetMleKey());
+#endif
     }
+#elif OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    ComputeKeys(mKeySequence - 1, hashKeys);
+    mAdjacentMleKeys[kPrevKeySequence].SetFrom(hashKeys.GetMleKey());
+    ComputeKeys(mKeySequence + 1, hashKeys);
+    mAdjacentMleKeys[kNextKeySequence].SetFrom(hashKeys.GetMleKey());
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -357,10 +371,52 @@ void KeyManager::UpdateKeyMaterial(void)
 
         ComputeTrelKey(mKeySequence, key);
         mTrelKey.SetFrom(key);
+
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+        ComputeTrelKey(mKeySequence - 1, key);
+        mAdjacentTrelKeys[kPrevKeySequence].SetFrom(key);
+        ComputeTrelKey(mKeySequence + 1, key);
+        mAdjacentTrelKeys[kNextKeySequence].SetFrom(key);
+#endif
     }
 #endif
 }
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+Error KeyManager::FindAdjacentKeySequence(uint32_t aKeySequence, AdjacentKeySequence &aAdjacent)
+{
+    // Determines whether `aKeySequence` is adjacent to the current
+    // key sequence (i.e., its derived keys are cached) and updates
+    // the cache hit/miss counters accordingly.
+
+    Error error = kErrorNone;
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        aAdjacent = kPrevKeySequence;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        aAdjacent = kNextKeySequence;
+    }
+    else
+    {
+        error = kErrorNotFound;
+    }
+
+    if (error == kErrorNone)
+    {
+        mKeyCacheCounters.mHits++;
+    }
+    else
+    {
+        mKeyCacheCounters.mMisses++;
+    }
+
+    return error;
+}
+#endif
+
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence, KeySeqUpdateFlags aFlags)
 {
     VerifyOrExit(aKeySequence != mKeySequence, Get<Notifier>().SignalIfFirst(kEventThreadKeySeqCounterChanged));
@@ -416,35 +472,83 @@ exit:
 
 const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const Mle::KeyMaterial *key = &mTemporaryMleKey;
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    AdjacentKeySequence adjacent;
 
-    return mTemporaryMleKey;
+    if (FindAdjacentKeySequence(aKeySequence, adjacent) == kErrorNone)
+    {
+        key = &mAdjacentMleKeys[adjacent];
+    }
+    else
+#endif
+    {
+        HashKeys hashKeys;
+
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+    }
+
+    return *key;
 }
 
 #if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
 const Mle::KeyMaterial &KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const Mle::KeyMaterial *key = &mTemporaryMacKey;
+
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE && OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    // The 15.4 MAC keys for the current and adjacent key sequences
+    // are already held by `SubMac`.
+
+    AdjacentKeySequence adjacent;
+
+    if (aKeySequence == mKeySequence)
+    {
+        mKeyCacheCounters.mHits++;
+        key = &Get<Mac::SubMac>().GetMacKey(Mac::KeyTrio::kCur);
+    }
+    else if (FindAdjacentKeySequence(aKeySequence, adjacent) == kErrorNone)
+    {
+        key = &Get<Mac::SubMac>().GetMacKey((adjacent == kPrevKeySequence) ? Mac::KeyTrio::kPrev
+                                                                           : Mac::KeyTrio::kNext);
+    }
+    else
+#endif
+    {
+        HashKeys hashKeys;
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMacKey.SetFrom(hashKeys.GetMacKey());
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMacKey.SetFrom(hashKeys.GetMacKey());
+    }
 
-    return mTemporaryMacKey;
+    return *key;
 }
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    const Mac::KeyMaterial *keyMaterial = &mTemporaryTrelKey;
 
-    ComputeTrelKey(aKeySequence, key);
-    mTemporaryTrelKey.SetFrom(key);
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    AdjacentKeySequence adjacent;
 
-    return mTemporaryTrelKey;
+    if (FindAdjacentKeySequence(aKeySequence, adjacent) == kErrorNone)
+    {
+        keyMaterial = &mAdjacentTrelKeys[adjacent];
+    }
+    else
+#endif
+    {
+        Mac::Key key;
+
+        ComputeTrelKey(aKeySequence, key);
+        mTemporaryTrelKey.SetFrom(key);
+    }
+
+    return *keyMaterial;
 }
 #endif
 
@@ -698,6 +802,18 @@ void KeyManager::DestroyTemporaryKeys(void)
 {
     mMleKey.Clear();
     mKek.Clear();
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    for (Mle::KeyMaterial &mleKey : mAdjacentMleKeys)
+    {
+        mleKey.Clear();
+    }
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    for (Mac::KeyMaterial &trelKey : mAdjacentTrelKeys)
+    {
+        trelKey.Clear();
+    }
+#endif
+#endif
     mIsKekSet = false;
     Get<Mac::SubMac>().ClearMacKeys();
 }
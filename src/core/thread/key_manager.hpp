@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include <openthread/dataset.h>
+#include <openthread/thread.h>
 #include <openthread/platform/crypto.h>
 
 #include "common/as_core_type.hpp"
@@ -197,6 +198,15 @@ typedef Mac::Key Kek;
  */
 typedef Mac::KeyMaterial KekKeyMaterial;
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+/**
+ * Represents the derived key cache counters.
+ */
+class KeyCacheCounters : public otKeyCacheCounters, public Clearable<KeyCacheCounters>
+{
+};
+#endif
+
 /**
  * Defines Thread Key Manager.
  */
@@ -376,6 +386,20 @@ public:
      */
     const Mle::KeyMaterial &GetTemporaryMacKey(uint32_t aKeySequence);
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    /**
+     * Returns the derived key cache counters.
+     *
+     * @returns The key cache counters.
+     */
+    const KeyCacheCounters &GetKeyCacheCounters(void) const { return mKeyCacheCounters; }
+
+    /**
+     * Resets the derived key cache counters.
+     */
+    void ResetKeyCacheCounters(void) { mKeyCacheCounters.Clear(); }
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * Returns the current MAC Frame Counter value for 15.4 radio link.
@@ -594,6 +618,17 @@ private:
 
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    enum AdjacentKeySequence : uint8_t
+    {
+        kPrevKeySequence,        // `mKeySequence - 1`
+        kNextKeySequence,        // `mKeySequence + 1`
+        kNumAdjacentKeySequences,
+    };
+
+    Error FindAdjacentKeySequence(uint32_t aKeySequence, AdjacentKeySequence &aAdjacent);
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const;
 #endif
@@ -637,6 +672,14 @@ private:
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    Mle::KeyMaterial mAdjacentMleKeys[kNumAdjacentKeySequences];
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    Mac::KeyMaterial mAdjacentTrelKeys[kNumAdjacentKeySequences];
+#endif
+    KeyCacheCounters mKeyCacheCounters;
+#endif
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
@@ -668,6 +711,9 @@ private:
 DefineCoreType(otSecurityPolicy, SecurityPolicy);
 DefineCoreType(otNetworkKey, NetworkKey);
 DefineCoreType(otPskc, Pskc);
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+DefineCoreType(otKeyCacheCounters, KeyCacheCounters);
+#endif
 
 } // namespace ot
 
@@ -110,7 +110,11 @@ void MeshForwarder::Stop(void)
     Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMeshForwarder);
     Get<Mle::DiscoverScanner>().Stop();
 
-    mSendQueue.DequeueAndFreeAll();
+    for (PriorityQueue &queue : mSendQueues)
+    {
+        queue.DequeueAndFreeAll();
+    }
+
     mReassemblyList.DequeueAndFreeAll();
 
 #if OPENTHREAD_FTD
@@ -303,22 +307,22 @@ Error MeshForwarder::RemoveAgedMessages(void)
     // messages. It returns `kErrorNone` if at least one message was
     // removed, or `kErrorNotFound` if none was removed.
 
-    Error    error = kErrorNotFound;
-    Message *nextMessage;
+    Error error = kErrorNotFound;
 
-    for (Message *message = mSendQueue.GetHead(); message != nullptr; message = nextMessage)
+    for (uint8_t type = 0; type < kNumDirectTxQueues; type++)
     {
-        nextMessage = message->GetNext();
-
-        // Exclude the current message being sent `mSendMessage`.
-        if ((message == mSendMessage) || !message->IsDirectTransmission() || message->GetDoNotEvict())
+        for (Message &message : mSendQueues[type])
         {
-            continue;
-        }
+            // Exclude the current message being sent `mSendMessage`.
+            if ((&message == mSendMessage) || message.GetDoNotEvict())
+            {
+                continue;
+            }
 
-        if (UpdateEcnOrDrop(*message, /* aPreparingToSend */ false) == kErrorDrop)
-        {
-            error = kErrorNone;
+            if (UpdateEcnOrDrop(message, /* aPreparingToSend */ false) == kErrorDrop)
+            {
+                error = kErrorNone;
+            }
         }
     }
 
@@ -333,55 +337,58 @@ bool MeshForwarder::IsDirectTxQueueOverMaxFrameThreshold(void) const
 {
     uint16_t frameCount = 0;
 
-    for (const Message &message : mSendQueue)
+    for (uint8_t type = 0; type < kNumDirectTxQueues; type++)
     {
-        if (!message.IsDirectTransmission() || (&message == mSendMessage))
+        for (const Message &message : mSendQueues[type])
         {
-            continue;
-        }
-
-        switch (message.GetType())
-        {
-        case Message::kTypeIp6:
-        {
-            // If it is an IPv6 message, we estimate the number of
-            // fragment frames assuming typical header sizes and lowpan
-            // compression. Since this estimate is only used for queue
-            // management, we lean towards an under estimate in sense
-            // that we may allow few more frames in the tx queue over
-            // threshold in some rare cases.
-            //
-            // The constants below are derived as follows: Typical MAC
-            // header (15 bytes) and MAC footer (6 bytes) leave 106
-            // bytes for MAC payload. Next fragment header is 5 bytes
-            // leaving 96 for next fragment payload. Lowpan compression
-            // on average compresses 40 bytes IPv6 header into about 19
-            // bytes leaving 87 bytes for the IPv6 payload, so the first
-            // fragment can fit 87 + 40 = 127 bytes.
-
-            static constexpr uint16_t kFirstFragmentMaxLength = 127;
-            static constexpr uint16_t kNextFragmentSize       = 96;
-
-            uint16_t length = message.GetLength();
-
-            frameCount++;
-
-            if (length > kFirstFragmentMaxLength)
+            if (&message == mSendMessage)
             {
-                frameCount += (length - kFirstFragmentMaxLength) / kNextFragmentSize;
+                continue;
             }
 
-            break;
-        }
+            switch (message.GetType())
+            {
+            case Message::kTypeIp6:
+            {
+                // If it is an IPv6 message, we estimate the number of
+                // fragment frames assuming typical header sizes and lowpan
+                // compression. Since this estimate is only used for queue
+                // management, we lean towards an under estimate in sense
+                // that we may allow few more frames in the tx queue over
+                // threshold in some rare cases.
+                //
+                // The constants below are derived as follows: Typical MAC
+                // header (15 bytes) and MAC footer (6 bytes) leave 106
+                // bytes for MAC payload. Next fragment header is 5 bytes
+                // leaving 96 for next fragment payload. Lowpan compression
+                // on average compresses 40 bytes IPv6 header into about 19
+                // bytes leaving 87 bytes for the IPv6 payload, so the first
+                // fragment can fit 87 + 40 = 127 bytes.
+
+                static constexpr uint16_t kFirstFragmentMaxLength = 127;
+                static constexpr uint16_t kNextFragmentSize       = 96;
+
+                uint16_t length = message.GetLength();
+
+                frameCount++;
+
+                if (length > kFirstFragmentMaxLength)
+                {
+                    frameCount += (length - kFirstFragmentMaxLength) / kNextFragmentSize;
+                }
 
-        case Message::kType6lowpan:
-        case Message::kTypeMacEmptyData:
-            frameCount++;
-            break;
+                break;
+            }
 
-        case Message::kTypeSupervision:
-        default:
-            break;
+            case Message::kType6lowpan:
+            case Message::kTypeMacEmptyData:
+                frameCount++;
+                break;
+
+            case Message::kTypeSupervision:
+            default:
+                break;
+            }
         }
     }
 
@@ -474,7 +481,11 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
     Message *curMessage, *nextMessage;
     Error    error = kErrorNone;
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    // Only messages ready for direct tx are kept in `kDirectQueue`.
+    // Messages waiting for address resolution or pending only
+    // indirect tx are in other queues and need not be skipped here.
+
+    for (curMessage = mSendQueues[kDirectQueue].GetHead(); curMessage; curMessage = nextMessage)
     {
         // We set the `nextMessage` here but it can be updated again
         // after the `switch(message.GetType())` since it may be
@@ -483,11 +494,6 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
         nextMessage = curMessage->GetNext();
 
-        if (!curMessage->IsDirectTransmission() || curMessage->IsResolvingAddress())
-        {
-            continue;
-        }
-
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
         if (UpdateEcnOrDrop(*curMessage, /* aPreparingToSend */ true) == kErrorDrop)
         {
@@ -526,15 +532,18 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
         // the next message may have been evicted during processing (e.g. due to Address Solicit)
         nextMessage = curMessage->GetNext();
 
+        // `UpdateIp6Route()` may determine the destination is an ALOC
+        // associated with an SED child of this device and un-mark the
+        // message for direct tx, so we move it to its new queue.
+
+        UpdateSendQueue(*curMessage, mSendQueues[kDirectQueue]);
+
         switch (error)
         {
         case kErrorNone:
             if (!curMessage->IsDirectTransmission())
             {
                 // Skip if message is no longer marked for direct transmission.
-                // For example, `UpdateIp6Route()` may determine the destination
-                // is an ALOC associated with an SED child of this device and
-                // mark it for indirect tx to the SED child.
                 continue;
             }
 
@@ -546,6 +555,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 #if OPENTHREAD_FTD
         case kErrorAddressQuery:
             curMessage->SetResolvingAddress(true);
+            UpdateSendQueue(*curMessage, mSendQueues[kDirectQueue]);
             continue;
 #endif
 
@@ -942,7 +952,7 @@ void MeshForwarder::FinalizeMessageDirectTx(Message &aMessage, Error aError)
 
     VerifyOrExit(aMessage.IsDirectTransmission());
 
-    aMessage.ClearDirectTransmission();
+    ClearDirectTransmission(aMessage);
     aMessage.SetOffset(0);
 
     if (aError != kErrorNone)
@@ -986,13 +996,84 @@ bool MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
         mMessageNextOffset = 0;
     }
 
-    mSendQueue.DequeueAndFree(aMessage);
+    GetSendQueueFor(aMessage).DequeueAndFree(aMessage);
     didRemove = true;
 
 exit:
     return didRemove;
 }
 
+PriorityQueue &MeshForwarder::GetSendQueueFor(const Message &aMessage)
+{
+    SendQueueType type = kDirectQueue;
+
+#if OPENTHREAD_FTD
+    if (!aMessage.IsDirectTransmission())
+    {
+        type = kIndirectQueue;
+    }
+    else if (aMessage.IsResolvingAddress())
+    {
+        type = kResolvingQueue;
+    }
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+#endif
+
+    return mSendQueues[type];
+}
+
+void MeshForwarder::UpdateSendQueue(Message &aMessage, PriorityQueue &aCurrentQueue)
+{
+    // Moves `aMessage` from `aCurrentQueue` to the queue matching its
+    // current state. The message is appended at the tail of its
+    // priority level in the new queue.
+
+    PriorityQueue &newQueue = GetSendQueueFor(aMessage);
+
+    VerifyOrExit(&newQueue != &aCurrentQueue);
+
+    aCurrentQueue.Dequeue(aMessage);
+    newQueue.Enqueue(aMessage);
+
+exit:
+    return;
+}
+
+void MeshForwarder::UpdateDirectTransmission(Message &aMessage, bool aDirectTx)
+{
+    PriorityQueue *queue = aMessage.IsInAPriorityQueue() ? &GetSendQueueFor(aMessage) : nullptr;
+
+    if (aDirectTx)
+    {
+        aMessage.SetDirectTransmission();
+    }
+    else
+    {
+        aMessage.ClearDirectTransmission();
+    }
+
+    if (queue != nullptr)
+    {
+        UpdateSendQueue(aMessage, *queue);
+    }
+}
+
+void MeshForwarder::GetQueueInfo(PriorityQueue::Info &aSendQueueInfo, MessageQueue::Info &aReassemblyQueueInfo) const
+{
+    ClearAllBytes(aSendQueueInfo);
+
+    for (const PriorityQueue &queue : mSendQueues)
+    {
+        PriorityQueue::Info info;
+
+        queue.GetInfo(info);
+        MessageQueue::AddQueueInfos(aSendQueueInfo, info);
+    }
+
+    mReassemblyList.GetInfo(aReassemblyQueueInfo);
+}
+
 Error MeshForwarder::RxInfo::ParseIp6Headers(void)
 {
     Error error = kErrorNone;
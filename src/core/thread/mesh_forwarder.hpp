@@ -161,6 +161,26 @@ public:
      */
     void SetRxOnWhenIdle(bool aRxOnWhenIdle);
 
+    /**
+     * Marks a message for direct transmission.
+     *
+     * If @p aMessage is in the send queue, it is moved to the send queue matching its new state. @p aMessage MUST
+     * either be in the send queue or not be in any queue.
+     *
+     * @param[in] aMessage  The message to mark for direct transmission.
+     */
+    void SetDirectTransmission(Message &aMessage) { UpdateDirectTransmission(aMessage, true); }
+
+    /**
+     * Clears direct transmission on a message.
+     *
+     * If @p aMessage is in the send queue, it is moved to the send queue matching its new state. @p aMessage MUST
+     * either be in the send queue or not be in any queue.
+     *
+     * @param[in] aMessage  The message to clear direct transmission on.
+     */
+    void ClearDirectTransmission(Message &aMessage) { UpdateDirectTransmission(aMessage, false); }
+
 #if OPENTHREAD_FTD
     typedef IndirectSender::MessageChecker MessageChecker; ///< General predicate function checking a message.
 
@@ -184,15 +204,12 @@ public:
      * Retrieves information about the send queue and the reassembly queue.
      *
      * Provides details such as the number of messages and data buffers currently utilized by the priority send queue
-     * and the message reassembly queue.
+     * and the message reassembly queue. The send queue info covers all messages pending direct or indirect tx.
      *
      * @param[out] aSendQueueInfo         A `PriorityQueue::Info` to populate with info about the send queue.
      * @param[out] aReassemblyQueueInfo   A `MessageQueue::Info` to populate with info about the reassembly queue.
      */
-    void GetQueueInfo(PriorityQueue::Info &aSendQueueInfo, MessageQueue::Info &aReassemblyQueueInfo) const
-    {
-        mSendQueue.GetInfo(aSendQueueInfo), mReassemblyList.GetInfo(aReassemblyQueueInfo);
-    }
+    void GetQueueInfo(PriorityQueue::Info &aSendQueueInfo, MessageQueue::Info &aReassemblyQueueInfo) const;
 
     /**
      * Returns a reference to the IP level counters.
@@ -290,6 +307,32 @@ private:
     static constexpr uint32_t kTimeInQueueDropMsg = OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_DROP_MSG_INTERVAL;
 #endif
 
+    // Messages pending tx are kept in separate priority queues based
+    // on their state, so that selecting the next direct tx does not
+    // need to skip over messages waiting for address resolution or
+    // pending only indirect tx to sleepy children. The queue holding
+    // a message is determined by `GetSendQueueFor()` from its direct
+    // tx and resolving address flags, and `UpdateSendQueue()` must be
+    // called whenever these flags are changed on a queued message.
+    // Code outside `MeshForwarder` changes the direct tx flag through
+    // `SetDirectTransmission()` and `ClearDirectTransmission()`.
+
+    enum SendQueueType : uint8_t
+    {
+        kDirectQueue, // Messages pending direct tx.
+#if OPENTHREAD_FTD
+        kResolvingQueue, // Messages pending direct tx, waiting for address resolution.
+        kIndirectQueue,  // Messages pending only indirect tx to sleepy children.
+#endif
+        kNumSendQueues,
+    };
+
+#if OPENTHREAD_FTD
+    static constexpr uint8_t kNumDirectTxQueues = kIndirectQueue; // Queues before `kIndirectQueue` hold direct tx.
+#else
+    static constexpr uint8_t kNumDirectTxQueues = kNumSendQueues;
+#endif
+
     enum EvictReason : uint8_t // Used in EvictMessage()
     {
         kEvictReasonNoMessageBuffer,
@@ -469,6 +512,10 @@ private:
     void FinalizeAndRemoveMessage(Message &aMessage, Error aError, MessageAction aAction);
     bool RemoveMessageIfNoPendingTx(Message &aMessage);
 
+    PriorityQueue &GetSendQueueFor(const Message &aMessage);
+    void           UpdateSendQueue(Message &aMessage, PriorityQueue &aCurrentQueue);
+    void           UpdateDirectTransmission(Message &aMessage, bool aDirectTx);
+
     void HandleTimeTick(void);
     void ScheduleTransmissionTask(void);
 
@@ -545,7 +592,7 @@ private:
     using TxDelayTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleTxDelayTimer>;
 #endif
 
-    PriorityQueue mSendQueue;
+    PriorityQueue mSendQueues[kNumSendQueues];
     MessageQueue  mReassemblyList;
     uint16_t      mMessageNextOffset;
 
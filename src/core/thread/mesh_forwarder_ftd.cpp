@@ -43,12 +43,15 @@ RegisterLogModule("MeshForwarder");
 
 void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
 {
-    Message &message = *aMessagePtr.Release();
+    Message       &message = *aMessagePtr.Release();
+    PriorityQueue *queue;
 
     message.SetOffset(0);
     message.SetDatagramTag(0);
     message.SetTimestampToNow();
-    mSendQueue.Enqueue(message);
+
+    queue = &GetSendQueueFor(message);
+    queue->Enqueue(message);
 
     switch (message.GetType())
     {
@@ -120,6 +123,8 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
         break;
     }
 
+    UpdateSendQueue(message, *queue);
+
     // Ensure that the message is marked for direct tx and/or for indirect tx
     // to a sleepy child. Otherwise, remove the message.
 
@@ -143,13 +148,8 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
     Ip6::Address ip6Dst;
     bool         didUpdate = false;
 
-    for (Message &message : mSendQueue)
+    for (Message &message : mSendQueues[kResolvingQueue])
     {
-        if (!message.IsResolvingAddress())
-        {
-            continue;
-        }
-
         IgnoreError(message.Read(Ip6::Header::kDestinationFieldOffset, ip6Dst));
 
         if (ip6Dst != aEid)
@@ -166,6 +166,7 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
         }
 
         message.SetResolvingAddress(false);
+        UpdateSendQueue(message, mSendQueues[kResolvingQueue]);
         didUpdate = true;
     }
 
@@ -191,27 +192,30 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority, EvictReason aEvic
     // Search for a lower priority message to evict
     for (uint8_t priority = 0; priority < aPriority; priority++)
     {
-        for (Message *message = mSendQueue.GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
-             message          = message->GetNext())
+        for (PriorityQueue &queue : mSendQueues)
         {
-            if (message->GetPriority() != priority)
+            for (Message *message = queue.GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
+                 message          = message->GetNext())
             {
-                break;
-            }
+                if (message->GetPriority() != priority)
+                {
+                    break;
+                }
 
-            if (message->GetDoNotEvict())
-            {
-                continue;
-            }
+                if (message->GetDoNotEvict())
+                {
+                    continue;
+                }
 
-            if ((aEvictReason == kEvictReasonDirectTxQueueAtLimit) && !message->IsDirectTransmission())
-            {
-                continue;
-            }
+                if ((aEvictReason == kEvictReasonDirectTxQueueAtLimit) && !message->IsDirectTransmission())
+                {
+                    continue;
+                }
 
-            evict = message;
-            error = kErrorNone;
-            ExitNow();
+                evict = message;
+                error = kErrorNone;
+                ExitNow();
+            }
         }
     }
 
@@ -220,22 +224,25 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority, EvictReason aEvic
     for (uint8_t priority = aPriority; priority < Message::kNumPriorities; priority++)
     {
         // search for an equal or higher priority indirect message to evict
-        for (Message *message = mSendQueue.GetHeadForPriority(aPriority); message; message = message->GetNext())
+        for (PriorityQueue &queue : mSendQueues)
         {
-            if (message->GetPriority() != priority)
+            for (Message *message = queue.GetHeadForPriority(aPriority); message; message = message->GetNext())
             {
-                break;
-            }
+                if (message->GetPriority() != priority)
+                {
+                    break;
+                }
 
-            if (message->GetDoNotEvict())
-            {
-                continue;
-            }
+                if (message->GetDoNotEvict())
+                {
+                    continue;
+                }
 
-            if (!message->GetIndirectTxChildMask().IsEmpty())
-            {
-                evict = message;
-                ExitNow(error = kErrorNone);
+                if (!message->GetIndirectTxChildMask().IsEmpty())
+                {
+                    evict = message;
+                    ExitNow(error = kErrorNone);
+                }
             }
         }
     }
@@ -260,39 +267,46 @@ exit:
 
 void MeshForwarder::RemoveMessagesForChild(Child &aChild, MessageChecker &aMessageChecker)
 {
-    for (Message &message : mSendQueue)
-    {
-        if (!aMessageChecker(message))
-        {
-            continue;
-        }
+    // The send queues are visited in reverse order. Clearing direct
+    // tx on a message moves it to `kIndirectQueue`, which is the last
+    // queue, so a moved message is never visited twice.
 
-        if (mIndirectSender.RemoveMessageFromSleepyChild(message, aChild) != kErrorNone)
+    for (uint8_t type = kNumSendQueues; type > 0; type--)
+    {
+        for (Message &message : mSendQueues[type - 1])
         {
-            const Neighbor *neighbor = nullptr;
-
-            if (message.GetType() == Message::kTypeIp6)
+            if (!aMessageChecker(message))
             {
-                Ip6::Header ip6header;
-
-                IgnoreError(message.Read(0, ip6header));
-                neighbor = Get<NeighborTable>().FindNeighbor(ip6header.GetDestination());
+                continue;
             }
-            else if (message.GetType() == Message::kType6lowpan)
+
+            if (mIndirectSender.RemoveMessageFromSleepyChild(message, aChild) != kErrorNone)
             {
-                Lowpan::MeshHeader meshHeader;
+                const Neighbor *neighbor = nullptr;
 
-                IgnoreError(meshHeader.ParseFrom(message));
-                neighbor = Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination());
-            }
+                if (message.GetType() == Message::kTypeIp6)
+                {
+                    Ip6::Header ip6header;
 
-            if (&aChild == neighbor)
-            {
-                message.ClearDirectTransmission();
+                    IgnoreError(message.Read(0, ip6header));
+                    neighbor = Get<NeighborTable>().FindNeighbor(ip6header.GetDestination());
+                }
+                else if (message.GetType() == Message::kType6lowpan)
+                {
+                    Lowpan::MeshHeader meshHeader;
+
+                    IgnoreError(meshHeader.ParseFrom(message));
+                    neighbor = Get<NeighborTable>().FindNeighbor(meshHeader.GetDestination());
+                }
+
+                if (&aChild == neighbor)
+                {
+                    ClearDirectTransmission(message);
+                }
             }
-        }
 
-        RemoveMessageIfNoPendingTx(message);
+            RemoveMessageIfNoPendingTx(message);
+        }
     }
 }
 
@@ -312,11 +326,14 @@ exit:
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    for (Message &message : mSendQueue)
+    for (PriorityQueue &queue : mSendQueues)
     {
-        if (message.IsMleCommand(Mle::kCommandDataResponse))
+        for (Message &message : queue)
         {
-            FinalizeAndRemoveMessage(message, kErrorDrop, kMessageDrop);
+            if (message.IsMleCommand(Mle::kCommandDataResponse))
+            {
+                FinalizeAndRemoveMessage(message, kErrorDrop, kMessageDrop);
+            }
         }
     }
 }
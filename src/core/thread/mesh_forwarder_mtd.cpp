@@ -46,7 +46,7 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     message.SetDatagramTag(0);
     message.SetTimestampToNow();
 
-    mSendQueue.Enqueue(message);
+    mSendQueues[kDirectQueue].Enqueue(message);
     mScheduleTransmissionTask.Post();
 
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
@@ -67,7 +67,7 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority, EvictReason aEvic
     VerifyOrExit(error == kErrorNotFound);
 #endif
 
-    VerifyOrExit((message = mSendQueue.GetTail()) != nullptr);
+    VerifyOrExit((message = mSendQueues[kDirectQueue].GetTail()) != nullptr);
 
     VerifyOrExit(!message->GetDoNotEvict());
 
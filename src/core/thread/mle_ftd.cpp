@@ -1874,7 +1874,7 @@ void Mle::SendParentResponse(const ParentResponseInfo &aInfo)
     VerifyOrExit(child != nullptr);
 
     VerifyOrExit((message = NewMleMessage(kCommandParentResponse)) != nullptr, error = kErrorNoBufs);
-    message->SetDirectTransmission();
+    Get<MeshForwarder>().SetDirectTransmission(*message);
 
     SuccessOrExit(error = message->AppendSourceAddressAndLeaderDataTlvs());
     SuccessOrExit(error = message->AppendLinkAndMleFrameCounterTlvs());
@@ -2787,7 +2787,7 @@ Error Mle::SendDiscoveryResponse(const Ip6::Address &aDestination, const Discove
     MeshCoP::DiscoveryResponseTlvValue discoveryResponseTlvValue;
 
     VerifyOrExit((message = NewMleMessage(kCommandDiscoveryResponse)) != nullptr, error = kErrorNoBufs);
-    message->SetDirectTransmission();
+    Get<MeshForwarder>().SetDirectTransmission(*message);
     message->SetPanId(aInfo.mPanId);
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     message->SetRadioType(aInfo.mRadioType);
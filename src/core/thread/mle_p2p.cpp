@@ -237,7 +237,7 @@ Error Mle::P2p::SendP2pLinkAcceptVariant(const LinkAcceptInfo &aInfo, bool aIsLi
 
         peer->GenerateChallenge();
         SuccessOrExit(error = message->AppendChallengeTlv(peer->GetChallenge()));
-        message->SetDirectTransmission();
+        Get<MeshForwarder>().SetDirectTransmission(*message);
     }
     else
     {
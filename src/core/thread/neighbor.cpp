@@ -40,7 +40,10 @@ namespace ot {
 void Neighbor::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
+
+    RemoveFromChildTableIndex();
     mState = static_cast<uint8_t>(aState);
+    AddToChildTableIndex();
 
     if (mState == kStateValid)
     {
@@ -51,6 +54,38 @@ exit:
     return;
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    VerifyOrExit(mMacAddr != aAddress);
+
+    RemoveFromChildTableIndex();
+    mMacAddr = aAddress;
+    AddToChildTableIndex();
+
+exit:
+    return;
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    VerifyOrExit(mRloc16 != aRloc16);
+
+    RemoveFromChildTableIndex();
+    mRloc16 = aRloc16;
+    AddToChildTableIndex();
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+void Neighbor::RemoveFromChildTableIndex(void) { Get<ChildTable>().RemoveFromIndex(*this); }
+
+void Neighbor::AddToChildTableIndex(void) { Get<ChildTable>().AddToIndex(*this); }
+
+#endif
+
 uint32_t Neighbor::GetConnectionTime(void) const
 {
     return IsStateValid() ? Get<UptimeTracker>().GetUptimeInSeconds() - mConnectionStart : 0;
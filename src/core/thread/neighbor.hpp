@@ -173,6 +173,27 @@ public:
          */
         bool Matches(const Neighbor &aNeighbor) const;
 
+        /**
+         * Gets the state filter of the `AddressMatcher`.
+         *
+         * @returns The state filter.
+         */
+        StateFilter GetStateFilter(void) const { return mStateFilter; }
+
+        /**
+         * Gets the MAC short address (RLOC16) of the `AddressMatcher`.
+         *
+         * @returns The MAC short address, or `Mac::kShortAddrInvalid` if the matcher accepts any short address.
+         */
+        Mac::ShortAddress GetShortAddress(void) const { return mShortAddress; }
+
+        /**
+         * Gets the MAC extended address of the `AddressMatcher`.
+         *
+         * @returns A pointer to the MAC extended address, or `nullptr` if the matcher accepts any extended address.
+         */
+        const Mac::ExtAddress *GetExtAddress(void) const { return mExtAddress; }
+
     private:
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
@@ -354,7 +375,7 @@ public:
      *
      * @param[in]  aAddress  The Extended Address value to set.
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -454,7 +475,7 @@ public:
      *
      * @param[in]  aRloc16  The RLOC16 value.
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -712,6 +733,14 @@ protected:
      */
     void Init(Instance &aInstance);
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void RemoveFromChildTableIndex(void);
+    void AddToChildTableIndex(void);
+#else
+    void RemoveFromChildTableIndex(void) {}
+    void AddToChildTableIndex(void) {}
+#endif
+
 private:
     static constexpr uint32_t kLastRxFragmentTagTimeout = OPENTHREAD_CONFIG_MULTI_RADIO_FRAG_TAG_TIMEOUT; // in msec
 
@@ -43,6 +43,13 @@ RegisterLogModule("NetworkData");
 Leader::Leader(Instance &aInstance)
     : MutableNetworkData(aInstance, mTlvBuffer, 0, sizeof(mTlvBuffer))
     , mMaxLength(0)
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    , mIsContextCacheValid(false)
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    , mRouteTrieRoot(kNoRouteIndex)
+    , mIsRouteCacheValid(false)
+#endif
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     , mIsClone(false)
@@ -170,6 +177,30 @@ void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context
         aContext.InitForMeshLocalPrefix(GetInstance());
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    if (mIsContextCacheValid)
+    {
+        // `mContexts` is sorted by prefix length, so the first
+        // matching entry is the longest match.
+
+        for (const Lowpan::Context &context : mContexts)
+        {
+            if (context.mPrefix.GetLength() <= aContext.mPrefix.GetLength())
+            {
+                break;
+            }
+
+            if (aAddress.MatchesPrefix(context.mPrefix))
+            {
+                aContext = context;
+                break;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
     {
         contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
@@ -184,6 +215,11 @@ void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context
             aContext.InitFrom(*prefixTlv, *contextTlv);
         }
     }
+
+    ExitNow();
+
+exit:
+    return;
 }
 
 const PrefixTlv *Leader::FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const
@@ -218,6 +254,16 @@ void Leader::FindContextForId(uint8_t aContextId, Lowpan::Context &aContext) con
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    if (mIsContextCacheValid)
+    {
+        VerifyOrExit(aContextId < kNumContextIds);
+        VerifyOrExit(mContextIdIndex[aContextId] != kNoContextEntry);
+        aContext = mContexts[mContextIdIndex[aContextId]];
+        ExitNow();
+    }
+#endif
+
     prefixTlv = FindPrefixTlvForContextId(aContextId, contextTlv);
     VerifyOrExit(prefixTlv != nullptr);
 
@@ -234,6 +280,24 @@ bool Leader::IsOnMesh(const Ip6::Address &aAddress) const
 
     VerifyOrExit(!Get<Mle::Mle>().IsMeshLocalAddress(aAddress), isOnMesh = true);
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    if (mIsRouteCacheValid)
+    {
+        uint8_t prefixIndexes[kMaxRoutePrefixes];
+        uint8_t numPrefixes = FindMatchingRoutePrefixes(aAddress, prefixIndexes);
+
+        for (uint8_t i = 0; i < numPrefixes; i++)
+        {
+            if (mRoutePrefixes[prefixIndexes[i]].mIsOnMesh)
+            {
+                ExitNow(isOnMesh = true);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
     {
         TlvIterator            subTlvIterator(*prefixTlv);
@@ -261,21 +325,30 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
     Error            error     = kErrorNoRoute;
     const PrefixTlv *prefixTlv = nullptr;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    if (mIsRouteCacheValid)
     {
-        if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
+        VerifyOrExit(LookupRouteInCache(aSource, aDestination, aRloc16) != kErrorNone, error = kErrorNone);
+    }
+    else
+#endif
+    {
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
         {
-            continue;
-        }
+            if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
+            {
+                continue;
+            }
 
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
-        {
-            ExitNow(error = kErrorNone);
-        }
+            if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
 
-        if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
-        {
-            ExitNow(error = kErrorNone);
+            if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
         }
     }
 
@@ -362,6 +435,29 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    if (mIsRouteCacheValid)
+    {
+        uint8_t prefixIndexes[kMaxRoutePrefixes];
+        uint8_t numPrefixes = FindMatchingRoutePrefixes(aDestination, prefixIndexes);
+
+        // The matching prefixes are ordered from the shortest to the
+        // longest, the longest one with a route entry is used.
+
+        while (numPrefixes > 0)
+        {
+            const RoutePrefix &routePrefix = mRoutePrefixes[prefixIndexes[--numPrefixes]];
+
+            if ((routePrefix.mDomainId == aDomainId) && (routePrefix.mExternalRoutes.mLength > 0))
+            {
+                ExitNow(error = SelectRouteEntry(routePrefix.mExternalRoutes, aRloc16));
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
     {
         const HasRouteTlv *hasRoute;
@@ -399,6 +495,9 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
         error   = kErrorNone;
     }
 
+    ExitNow();
+
+exit:
     return error;
 }
 
@@ -687,9 +786,379 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    // The context cache is updated here rather than from the
+    // `Notifier` callback, since the `Notifier` events are delivered
+    // later from a tasklet and frames may be (de)compressed before.
+    UpdateContextCache();
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    UpdateRouteCache();
+#endif
+
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+
+void Leader::UpdateContextCache(void)
+{
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    mContexts.Clear();
+    memset(mContextIdIndex, kNoContextEntry, sizeof(mContextIdIndex));
+    mIsContextCacheValid = false;
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        Lowpan::Context  *entry;
+
+        if (contextTlv == nullptr)
+        {
+            continue;
+        }
+
+        VerifyOrExit(!mContexts.IsFull());
+
+        // Insert the new entry after all entries with the same or a
+        // longer prefix length, keeping `mContextIdIndex` in sync as
+        // entries are shifted. When a Context ID appears in more than
+        // one Prefix TLV, the first one in the Network Data is used
+        // (same as when searching the TLVs).
+
+        entry = mContexts.PushBack();
+
+        while ((entry != mContexts.Front()) && ((entry - 1)->mPrefix.GetLength() < prefixTlv->GetPrefixLength()))
+        {
+            *entry = *(entry - 1);
+
+            if (mContextIdIndex[entry->mContextId] == mContexts.IndexOf(*(entry - 1)))
+            {
+                mContextIdIndex[entry->mContextId] = mContexts.IndexOf(*entry);
+            }
+
+            entry--;
+        }
+
+        entry->InitFrom(*prefixTlv, *contextTlv);
+
+        if (mContextIdIndex[entry->mContextId] == kNoContextEntry)
+        {
+            mContextIdIndex[entry->mContextId] = mContexts.IndexOf(*entry);
+        }
+    }
+
+    mIsContextCacheValid = true;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+
+void Leader::UpdateRouteCache(void)
+{
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    mRoutePrefixes.Clear();
+    mRouteEntries.Clear();
+    mRouteNodes.Clear();
+    mRouteTrieRoot     = kNoRouteIndex;
+    mIsRouteCacheValid = false;
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        SuccessOrExit(AddRoutePrefixToCache(*prefixTlv));
+    }
+
+    mIsRouteCacheValid = true;
+
+exit:
+    return;
+}
+
+Error Leader::AddRoutePrefixToCache(const PrefixTlv &aPrefixTlv)
+{
+    Error                  error = kErrorNone;
+    RoutePrefix           *routePrefix;
+    TlvIterator            subTlvIterator(aPrefixTlv);
+    const BorderRouterTlv *brTlv;
+    Ip6::Prefix            prefix;
+
+    routePrefix = mRoutePrefixes.PushBack();
+    VerifyOrExit(routePrefix != nullptr, error = kErrorNoBufs);
+
+    routePrefix->mDomainId           = aPrefixTlv.GetDomainId();
+    routePrefix->mHasBorderRouterTlv = false;
+    routePrefix->mIsOnMesh           = false;
+
+    while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+    {
+        routePrefix->mHasBorderRouterTlv = true;
+
+        for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+             entry                          = entry->GetNext())
+        {
+            routePrefix->mIsOnMesh |= entry->IsOnMesh();
+        }
+    }
+
+    SuccessOrExit(error = AddRouteEntriesToCache<HasRouteTlv>(aPrefixTlv, routePrefix->mExternalRoutes));
+    SuccessOrExit(error = AddRouteEntriesToCache<BorderRouterTlv>(aPrefixTlv, routePrefix->mDefaultRoutes));
+
+    aPrefixTlv.CopyPrefixTo(prefix);
+    error = AddRouteNode(prefix, static_cast<uint8_t>(mRoutePrefixes.IndexOf(*routePrefix)));
+
+exit:
+    return error;
+}
+
+template <typename SubTlvType>
+Error Leader::AddRouteEntriesToCache(const PrefixTlv &aPrefixTlv, RouteEntryRange &aRange)
+{
+    // Only the entries with the highest preference are kept, since
+    // the preference takes precedence over all other criteria in
+    // `CompareRouteEntries()`. Among the kept entries, the Network
+    // Data order is preserved so that ties are resolved in the same
+    // way as when searching the TLVs.
+
+    Error  error         = kErrorNone;
+    int8_t maxPreference = NumericLimits<int8_t>::kMin;
+
+    aRange.mStart  = mRouteEntries.GetLength();
+    aRange.mLength = 0;
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        TlvIterator       subTlvIterator(aPrefixTlv);
+        const SubTlvType *subTlv;
+
+        while ((subTlv = subTlvIterator.Iterate<SubTlvType>()) != nullptr)
+        {
+            for (const auto *entry = subTlv->GetFirstEntry(); entry <= subTlv->GetLastEntry(); entry = entry->GetNext())
+            {
+                RouteEntry *routeEntry;
+
+                if (!ShouldCacheRouteEntry(*entry))
+                {
+                    continue;
+                }
+
+                if (pass == 0)
+                {
+                    maxPreference = Max(maxPreference, entry->GetPreference());
+                    continue;
+                }
+
+                if (entry->GetPreference() != maxPreference)
+                {
+                    continue;
+                }
+
+                routeEntry = mRouteEntries.PushBack();
+                VerifyOrExit(routeEntry != nullptr, error = kErrorNoBufs);
+
+                routeEntry->mRloc16     = entry->GetRloc();
+                routeEntry->mPreference = entry->GetPreference();
+                aRange.mLength++;
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Leader::AddRouteNode(const Ip6::Prefix &aPrefix, uint8_t aPrefixIndex)
+{
+    // Inserts `aPrefix` into the path-compressed trie. `nodeIndex`
+    // points to the link (root or child index) being followed.
+
+    Error      error     = kErrorNone;
+    uint8_t   *nodeIndex = &mRouteTrieRoot;
+    RouteNode *newNode;
+
+    while (*nodeIndex != kNoRouteIndex)
+    {
+        RouteNode &node        = mRouteNodes[*nodeIndex];
+        uint8_t    matchLength = Min(node.mPrefix.GetLength(), aPrefix.GetLength());
+
+        matchLength = static_cast<uint8_t>(CountMatchingBits(node.mPrefix.GetBytes(), aPrefix.GetBytes(), matchLength));
+
+        if (matchLength == node.mPrefix.GetLength())
+        {
+            if (matchLength == aPrefix.GetLength())
+            {
+                // Same prefix as a branch node. A prefix appearing in
+                // more than one Prefix TLV is not cached.
+
+                VerifyOrExit(node.mPrefixIndex == kNoRouteIndex, error = kErrorAlready);
+                node.mPrefixIndex = aPrefixIndex;
+                ExitNow();
+            }
+
+            nodeIndex = &node.mChildren[GetPrefixBit(aPrefix.GetBytes(), matchLength)];
+            continue;
+        }
+
+        // `aPrefix` diverges from `node` within `node` prefix (or is
+        // a shorter prefix of it), so a new node with the common
+        // prefix is inserted as the parent of `node`.
+
+        newNode = mRouteNodes.PushBack();
+        VerifyOrExit(newNode != nullptr, error = kErrorNoBufs);
+
+        newNode->mPrefix = aPrefix;
+        newNode->mPrefix.SetLength(matchLength);
+        newNode->mPrefix.Tidy();
+        newNode->mChildren[0] = kNoRouteIndex;
+        newNode->mChildren[1] = kNoRouteIndex;
+        newNode->mPrefixIndex = kNoRouteIndex;
+
+        newNode->mChildren[GetPrefixBit(node.mPrefix.GetBytes(), matchLength)] = *nodeIndex;
+        *nodeIndex = static_cast<uint8_t>(mRouteNodes.IndexOf(*newNode));
+
+        if (matchLength == aPrefix.GetLength())
+        {
+            newNode->mPrefixIndex = aPrefixIndex;
+            ExitNow();
+        }
+
+        nodeIndex = &newNode->mChildren[GetPrefixBit(aPrefix.GetBytes(), matchLength)];
+    }
+
+    newNode = mRouteNodes.PushBack();
+    VerifyOrExit(newNode != nullptr, error = kErrorNoBufs);
+
+    newNode->mPrefix      = aPrefix;
+    newNode->mChildren[0] = kNoRouteIndex;
+    newNode->mChildren[1] = kNoRouteIndex;
+    newNode->mPrefixIndex = aPrefixIndex;
+
+    *nodeIndex = static_cast<uint8_t>(mRouteNodes.IndexOf(*newNode));
+
+exit:
+    return error;
+}
+
+uint8_t Leader::GetPrefixBit(const uint8_t *aPrefix, uint8_t aBitIndex)
+{
+    return (aPrefix[aBitIndex / kBitsPerByte] >> (kBitsPerByte - 1 - (aBitIndex % kBitsPerByte))) & 1;
+}
+
+uint8_t Leader::FindMatchingRoutePrefixes(const Ip6::Address &aAddress, uint8_t *aPrefixIndexes) const
+{
+    // Walks down the trie following the bits of `aAddress` and
+    // collects the indexes of all matching prefixes, from the
+    // shortest to the longest. Returns the number of prefixes.
+
+    uint8_t numPrefixes = 0;
+    uint8_t nodeIndex   = mRouteTrieRoot;
+
+    while (nodeIndex != kNoRouteIndex)
+    {
+        const RouteNode &node = mRouteNodes[nodeIndex];
+
+        if (!aAddress.MatchesPrefix(node.mPrefix))
+        {
+            break;
+        }
+
+        if (node.mPrefixIndex != kNoRouteIndex)
+        {
+            aPrefixIndexes[numPrefixes++] = node.mPrefixIndex;
+        }
+
+        if (node.mPrefix.GetLength() == Ip6::Prefix::kMaxLength)
+        {
+            break;
+        }
+
+        nodeIndex = node.mChildren[GetPrefixBit(aAddress.GetBytes(), node.mPrefix.GetLength())];
+    }
+
+    return numPrefixes;
+}
+
+Error Leader::LookupRouteInCache(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+    Error   error = kErrorNoRoute;
+    uint8_t prefixIndexes[kMaxRoutePrefixes];
+    uint8_t numPrefixes = FindMatchingRoutePrefixes(aSource, prefixIndexes);
+
+    // The source prefixes are checked in Network Data order (same as
+    // when searching the TLVs), so the indexes are sorted first.
+
+    for (uint8_t i = 1; i < numPrefixes; i++)
+    {
+        uint8_t prefixIndex = prefixIndexes[i];
+        uint8_t j           = i;
+
+        for (; (j > 0) && (prefixIndexes[j - 1] > prefixIndex); j--)
+        {
+            prefixIndexes[j] = prefixIndexes[j - 1];
+        }
+
+        prefixIndexes[j] = prefixIndex;
+    }
+
+    for (uint8_t i = 0; i < numPrefixes; i++)
+    {
+        const RoutePrefix &routePrefix = mRoutePrefixes[prefixIndexes[i]];
+
+        if (!routePrefix.mHasBorderRouterTlv)
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookup(routePrefix.mDomainId, aDestination, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (SelectRouteEntry(routePrefix.mDefaultRoutes, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Leader::SelectRouteEntry(const RouteEntryRange &aRange, uint16_t &aRloc16) const
+{
+    Error             error     = kErrorNoRoute;
+    const RouteEntry *bestEntry = nullptr;
+
+    for (uint8_t index = aRange.mStart; index < aRange.mStart + aRange.mLength; index++)
+    {
+        const RouteEntry &entry = mRouteEntries[index];
+
+        if ((bestEntry == nullptr) ||
+            CompareRouteEntries(entry.mPreference, entry.mRloc16, bestEntry->mPreference, bestEntry->mRloc16) > 0)
+        {
+            bestEntry = &entry;
+        }
+    }
+
+    if (bestEntry != nullptr)
+    {
+        aRloc16 = bestEntry->mRloc16;
+        error   = kErrorNone;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 bool Leader::ContainsOmrPrefix(const Ip6::Prefix &aPrefix) const
@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include "coap/coap.hpp"
+#include "common/array.hpp"
 #include "common/const_cast.hpp"
 #include "common/non_copyable.hpp"
 #include "common/numeric_limits.hpp"
@@ -50,6 +51,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 namespace NetworkData {
 
 /**
@@ -68,6 +71,7 @@ class Leader : public MutableNetworkData, private NonCopyable
 {
     friend class Tmf::Agent;
     friend class Notifier;
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -451,6 +455,26 @@ private:
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
     void  SignalNetDataChanged(void);
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    void UpdateContextCache(void);
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    struct RouteEntryRange;
+
+    void           UpdateRouteCache(void);
+    Error          AddRoutePrefixToCache(const PrefixTlv &aPrefixTlv);
+    Error          AddRouteNode(const Ip6::Prefix &aPrefix, uint8_t aPrefixIndex);
+    uint8_t        FindMatchingRoutePrefixes(const Ip6::Address &aAddress, uint8_t *aPrefixIndexes) const;
+    Error          LookupRouteInCache(const Ip6::Address &aSource,
+                                      const Ip6::Address &aDestination,
+                                      uint16_t           &aRloc16) const;
+    Error          SelectRouteEntry(const RouteEntryRange &aRange, uint16_t &aRloc16) const;
+    static uint8_t GetPrefixBit(const uint8_t *aPrefix, uint8_t aBitIndex);
+    static bool    ShouldCacheRouteEntry(const HasRouteEntry &) { return true; }
+    static bool    ShouldCacheRouteEntry(const BorderRouterEntry &aEntry) { return aEntry.IsDefaultRoute(); }
+
+    template <typename SubTlvType> Error AddRouteEntriesToCache(const PrefixTlv &aPrefixTlv, RouteEntryRange &aRange);
+#endif
     const CommissioningDataTlv *FindCommissioningData(void) const;
     CommissioningDataTlv *FindCommissioningData(void) { return AsNonConst(AsConst(this)->FindCommissioningData()); }
     const MeshCoP::Tlv   *FindCommissioningDataSubTlv(uint8_t aType) const;
@@ -634,6 +658,75 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    // Contexts from Prefix TLVs in the Network Data, sorted by prefix
+    // length (longest first) with Network Data order kept among equal
+    // lengths. `mContextIdIndex` maps a Context ID to its entry in
+    // `mContexts` (or `kNoContextEntry`). `mIsContextCacheValid` is
+    // cleared when the Network Data holds more contexts than fit in
+    // `mContexts`, in which case the TLVs are searched directly.
+
+    static constexpr uint8_t kNumContextIds  = 16;
+    static constexpr uint8_t kNoContextEntry = 0xff;
+
+    Array<Lowpan::Context, kNumContextIds> mContexts;
+    uint8_t                                mContextIdIndex[kNumContextIds];
+    bool                                   mIsContextCacheValid;
+#endif
+
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    // Compiled forwarding table of the Prefix TLVs in the Network
+    // Data. `mRoutePrefixes` holds one entry per Prefix TLV in
+    // Network Data order, referring to its highest preference route
+    // and default route border router entries in `mRouteEntries`.
+    // `mRouteNodes` is a path-compressed binary trie over the
+    // prefixes rooted at `mRouteTrieRoot`. Each prefix adds at most
+    // one leaf and one branch node. `mIsRouteCacheValid` is cleared
+    // when the Network Data does not fit, in which case the TLVs are
+    // searched directly.
+
+    static constexpr uint8_t kMaxRoutePrefixes = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_PREFIXES;
+    static constexpr uint8_t kMaxRouteEntries  = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_ENTRIES;
+    static constexpr uint8_t kMaxRouteNodes    = 2 * kMaxRoutePrefixes;
+    static constexpr uint8_t kNoRouteIndex     = 0xff;
+
+    static_assert(kMaxRoutePrefixes < 128, "OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_MAX_PREFIXES must be < 128");
+
+    struct RouteEntry
+    {
+        uint16_t mRloc16;
+        int8_t   mPreference;
+    };
+
+    struct RouteEntryRange
+    {
+        uint8_t mStart;
+        uint8_t mLength;
+    };
+
+    struct RoutePrefix
+    {
+        uint8_t         mDomainId;
+        bool            mHasBorderRouterTlv;
+        bool            mIsOnMesh;
+        RouteEntryRange mExternalRoutes;
+        RouteEntryRange mDefaultRoutes;
+    };
+
+    struct RouteNode
+    {
+        Ip6::Prefix mPrefix;
+        uint8_t     mChildren[2];
+        uint8_t     mPrefixIndex; // Index in `mRoutePrefixes`, or `kNoRouteIndex` for a branch node.
+    };
+
+    Array<RoutePrefix, kMaxRoutePrefixes> mRoutePrefixes;
+    Array<RouteEntry, kMaxRouteEntries>   mRouteEntries;
+    Array<RouteNode, kMaxRouteNodes>      mRouteNodes;
+    uint8_t                               mRouteTrieRoot;
+    bool                                  mIsRouteCacheValid;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
@@ -45,6 +45,363 @@
 namespace ot {
 namespace Utils {
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
+const uint16_t Heap::kSmallBlockSizes[kNumSmallClasses] = {16, 32, 48, 64, 96, 128, 192, kMaxSmallBlockSize};
+
+Heap::Heap(void)
+    : mFreeSize(GetCapacity())
+{
+    for (uint16_t &head : mFreeRuns)
+    {
+        head = kNone;
+    }
+
+    for (uint16_t &head : mPartialPages)
+    {
+        head = kNone;
+    }
+
+    for (uint8_t index = 0; index < kNumSizeClasses; index++)
+    {
+        mSizeClassInfo[index].Clear();
+        mSizeClassInfo[index].mBlockSize = (index < kNumSmallClasses) ? kSmallBlockSizes[index] : 0;
+    }
+
+    InsertFreeRun(0, kNumPages);
+}
+
+void *Heap::CAlloc(size_t aCount, size_t aSize)
+{
+    void    *ret = nullptr;
+    uint32_t size;
+    uint8_t  sizeClass;
+
+    VerifyOrExit(aCount <= NumericLimits<uint32_t>::kMax);
+    VerifyOrExit(aSize <= NumericLimits<uint32_t>::kMax);
+
+    SuccessOrExit(SafeMultiply<uint32_t>(static_cast<uint32_t>(aCount), static_cast<uint32_t>(aSize), size));
+
+    VerifyOrExit(size > 0);
+
+    sizeClass = GetSizeClass(size);
+    ret       = (sizeClass == kLargeSizeClass) ? AllocateLarge(size) : AllocateSmall(sizeClass);
+
+    {
+        SizeClassInfo &info = mSizeClassInfo[sizeClass];
+
+        if (ret == nullptr)
+        {
+            info.mNumFailedAllocs++;
+            ExitNow();
+        }
+
+        info.mNumAllocs++;
+        info.mNumAllocated++;
+        info.mMaxAllocated = Max(info.mMaxAllocated, info.mNumAllocated);
+    }
+
+    memset(ret, 0, size);
+
+exit:
+    return ret;
+}
+
+void Heap::Free(void *aPointer)
+{
+    uint32_t offset;
+    uint16_t pageIndex;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    offset    = static_cast<uint32_t>(reinterpret_cast<uint8_t *>(aPointer) - mMemory.m8);
+    pageIndex = static_cast<uint16_t>(offset / kPageSize);
+
+    if (mPages[pageIndex].mState == kPageSmall)
+    {
+        FreeSmall(pageIndex, offset % kPageSize);
+    }
+    else
+    {
+        uint16_t       numPages = mPages[pageIndex].mRunLength;
+        SizeClassInfo &info     = mSizeClassInfo[kLargeSizeClass];
+
+        mFreeSize += static_cast<size_t>(numPages) * kPageSize;
+        info.mNumPages -= numPages;
+        info.mNumAllocated--;
+
+        FreePages(pageIndex, numPages);
+    }
+
+exit:
+    return;
+}
+
+Error Heap::GetSizeClassInfo(uint8_t aIndex, SizeClassInfo &aInfo) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aIndex < kNumSizeClasses, error = kErrorNotFound);
+    aInfo = mSizeClassInfo[aIndex];
+
+exit:
+    return error;
+}
+
+uint8_t Heap::GetSizeClass(uint32_t aSize)
+{
+    uint8_t sizeClass = kLargeSizeClass;
+
+    VerifyOrExit(aSize <= kMaxSmallBlockSize);
+
+    for (sizeClass = 0; kSmallBlockSizes[sizeClass] < aSize; sizeClass++)
+    {
+    }
+
+exit:
+    return sizeClass;
+}
+
+uint8_t Heap::GetFreeRunBin(uint16_t aRunLength)
+{
+    uint8_t bin = 0;
+
+    while (aRunLength >>= 1)
+    {
+        bin++;
+    }
+
+    return bin;
+}
+
+void *Heap::AllocateSmall(uint8_t aSizeClass)
+{
+    uint8_t *ret       = nullptr;
+    uint16_t pageIndex = mPartialPages[aSizeClass];
+    uint16_t blockIndex;
+
+    if (pageIndex == kNone)
+    {
+        pageIndex = AllocatePages(1);
+        VerifyOrExit(pageIndex != kNone);
+
+        MarkRun(pageIndex, 1, kPageSmall);
+        mPages[pageIndex].mSizeClass = aSizeClass;
+        mPages[pageIndex].mNumUsed   = 0;
+        mPages[pageIndex].mNumCarved = 0;
+        mPages[pageIndex].mFreeBlock = kNone;
+
+        PushPage(mPartialPages[aSizeClass], pageIndex);
+        mSizeClassInfo[aSizeClass].mNumPages++;
+    }
+
+    {
+        Page &page = mPages[pageIndex];
+
+        if (page.mFreeBlock != kNone)
+        {
+            blockIndex      = page.mFreeBlock;
+            page.mFreeBlock = BlockLink(pageIndex, blockIndex, aSizeClass);
+        }
+        else
+        {
+            blockIndex = page.mNumCarved++;
+        }
+
+        page.mNumUsed++;
+
+        if (page.mNumUsed == GetBlocksPerPage(aSizeClass))
+        {
+            RemovePage(mPartialPages[aSizeClass], pageIndex);
+        }
+    }
+
+    mFreeSize -= kSmallBlockSizes[aSizeClass];
+    ret = GetPageMemory(pageIndex) + static_cast<uint32_t>(blockIndex) * kSmallBlockSizes[aSizeClass];
+
+exit:
+    return ret;
+}
+
+void Heap::FreeSmall(uint16_t aPageIndex, uint32_t aPageOffset)
+{
+    Page          &page       = mPages[aPageIndex];
+    uint8_t        sizeClass  = page.mSizeClass;
+    uint16_t       blockIndex = static_cast<uint16_t>(aPageOffset / kSmallBlockSizes[sizeClass]);
+    SizeClassInfo &info       = mSizeClassInfo[sizeClass];
+
+    if (page.mNumUsed == GetBlocksPerPage(sizeClass))
+    {
+        PushPage(mPartialPages[sizeClass], aPageIndex);
+    }
+
+    BlockLink(aPageIndex, blockIndex, sizeClass) = page.mFreeBlock;
+    page.mFreeBlock                              = blockIndex;
+    page.mNumUsed--;
+
+    mFreeSize += kSmallBlockSizes[sizeClass];
+    info.mNumAllocated--;
+
+    if (page.mNumUsed == 0)
+    {
+        RemovePage(mPartialPages[sizeClass], aPageIndex);
+        info.mNumPages--;
+        FreePages(aPageIndex, 1);
+    }
+}
+
+void *Heap::AllocateLarge(uint32_t aSize)
+{
+    uint8_t *ret      = nullptr;
+    uint32_t numPages = DivideAndRoundUp(aSize, kPageSize);
+    uint16_t pageIndex;
+
+    VerifyOrExit(numPages <= kNumPages);
+
+    pageIndex = AllocatePages(static_cast<uint16_t>(numPages));
+    VerifyOrExit(pageIndex != kNone);
+
+    MarkRun(pageIndex, static_cast<uint16_t>(numPages), kPageLarge);
+
+    mFreeSize -= static_cast<size_t>(numPages) * kPageSize;
+    mSizeClassInfo[kLargeSizeClass].mNumPages += numPages;
+
+    ret = GetPageMemory(pageIndex);
+
+exit:
+    return ret;
+}
+
+uint16_t Heap::AllocatePages(uint16_t aNumPages)
+{
+    // The runs in the bin of `aNumPages` may be shorter than
+    // `aNumPages`, so they are searched for the first one that fits.
+    // Any run in a higher bin is long enough.
+
+    uint16_t pageIndex = kNone;
+    uint8_t  bin       = GetFreeRunBin(aNumPages);
+    uint16_t runLength;
+
+    for (uint16_t index = mFreeRuns[bin]; index != kNone; index = mPages[index].mNext)
+    {
+        if (mPages[index].mRunLength >= aNumPages)
+        {
+            pageIndex = index;
+            break;
+        }
+    }
+
+    while ((pageIndex == kNone) && (++bin < kNumFreeRunBins))
+    {
+        pageIndex = mFreeRuns[bin];
+    }
+
+    VerifyOrExit(pageIndex != kNone);
+
+    runLength = mPages[pageIndex].mRunLength;
+    RemoveFreeRun(pageIndex);
+
+    if (runLength > aNumPages)
+    {
+        InsertFreeRun(pageIndex + aNumPages, runLength - aNumPages);
+    }
+
+exit:
+    return pageIndex;
+}
+
+void Heap::FreePages(uint16_t aPageIndex, uint16_t aNumPages)
+{
+    // Merges the run with its free neighbors. The page before a run
+    // is always the last page of the previous run, and the page
+    // after it the first page of the next run.
+
+    uint16_t nextIndex = aPageIndex + aNumPages;
+
+    if ((aPageIndex > 0) && (mPages[aPageIndex - 1].mState == kPageFree))
+    {
+        uint16_t prevRunLength = mPages[aPageIndex - 1].mRunLength;
+
+        aPageIndex -= prevRunLength;
+        aNumPages += prevRunLength;
+        RemoveFreeRun(aPageIndex);
+    }
+
+    if ((nextIndex < kNumPages) && (mPages[nextIndex].mState == kPageFree))
+    {
+        aNumPages += mPages[nextIndex].mRunLength;
+        RemoveFreeRun(nextIndex);
+    }
+
+    InsertFreeRun(aPageIndex, aNumPages);
+}
+
+void Heap::InsertFreeRun(uint16_t aPageIndex, uint16_t aNumPages)
+{
+    MarkRun(aPageIndex, aNumPages, kPageFree);
+    PushPage(mFreeRuns[GetFreeRunBin(aNumPages)], aPageIndex);
+}
+
+void Heap::RemoveFreeRun(uint16_t aPageIndex)
+{
+    RemovePage(mFreeRuns[GetFreeRunBin(mPages[aPageIndex].mRunLength)], aPageIndex);
+}
+
+void Heap::PushPage(uint16_t &aHead, uint16_t aPageIndex)
+{
+    mPages[aPageIndex].mPrev = kNone;
+    mPages[aPageIndex].mNext = aHead;
+
+    if (aHead != kNone)
+    {
+        mPages[aHead].mPrev = aPageIndex;
+    }
+
+    aHead = aPageIndex;
+}
+
+void Heap::RemovePage(uint16_t &aHead, uint16_t aPageIndex)
+{
+    const Page &page = mPages[aPageIndex];
+
+    if (page.mPrev != kNone)
+    {
+        mPages[page.mPrev].mNext = page.mNext;
+    }
+    else
+    {
+        aHead = page.mNext;
+    }
+
+    if (page.mNext != kNone)
+    {
+        mPages[page.mNext].mPrev = page.mPrev;
+    }
+}
+
+void Heap::MarkRun(uint16_t aPageIndex, uint16_t aNumPages, PageState aState)
+{
+    Page &first = mPages[aPageIndex];
+    Page &last  = mPages[aPageIndex + aNumPages - 1];
+
+    first.mState     = aState;
+    first.mRunLength = aNumPages;
+    last.mState      = aState;
+    last.mRunLength  = aNumPages;
+}
+
+uint16_t &Heap::BlockLink(uint16_t aPageIndex, uint16_t aBlockIndex, uint8_t aSizeClass)
+{
+    // A free block stores the index of the next free block in the
+    // same page at its start.
+
+    uint8_t *block = GetPageMemory(aPageIndex) + static_cast<uint32_t>(aBlockIndex) * kSmallBlockSizes[aSizeClass];
+
+    return *reinterpret_cast<uint16_t *>(reinterpret_cast<void *>(block));
+}
+
+#else // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
 Heap::Heap(void)
 {
     Block &super = BlockAt(kSuperBlockOffset);
@@ -230,6 +587,8 @@ void Heap::Free(void *aPointer)
     }
 }
 
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
@@ -36,17 +36,187 @@
 
 #include "openthread-core-config.h"
 
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE && OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+#error "OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE requires the internal heap"
+#endif
+
 #if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
 #include <stddef.h>
 #include <stdint.h>
 
+#include <openthread/heap.h>
+
+#include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
 #include "common/const_cast.hpp"
+#include "common/error.hpp"
 #include "common/non_copyable.hpp"
 
 namespace ot {
 namespace Utils {
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
+/**
+ * Defines functionality to manipulate heap using a segregated-fit allocator.
+ *
+ * The memory is divided into pages of `kPageSize` bytes. Free pages form runs of contiguous pages, which are kept in
+ * bins by the base-2 logarithm of their length (number of pages).
+ *
+ * - A small allocation (up to `kMaxSmallBlockSize` bytes) is rounded up to one of the small size classes and served
+ *   from a page dedicated to that class (a slab). Each class keeps a list of its pages which have a free block, so
+ *   allocating and freeing a small block is O(1).
+ * - A large allocation uses a run of whole pages. Freed runs are merged with their free neighbors.
+ *
+ * Block sizes and offsets are 32-bit, so the heap is not limited to 64 KiB.
+ */
+class Heap : private NonCopyable
+{
+public:
+    /**
+     * Represents information about a size class of the heap.
+     */
+    class SizeClassInfo : public otHeapSizeClassInfo, public Clearable<SizeClassInfo>
+    {
+    };
+
+    static constexpr uint8_t kNumSizeClasses = OT_HEAP_NUM_SIZE_CLASSES; ///< Number of size classes (incl. large).
+
+    /**
+     * Initializes a memory heap.
+     */
+    Heap(void);
+
+    /**
+     * Allocates at least @p aCount * @aSize bytes memory and initialize to zero.
+     *
+     * @param[in]   aCount  Number of allocate units.
+     * @param[in]   aSize   Unit size in bytes.
+     *
+     * @returns A pointer to the allocated memory.
+     *
+     * @retval  nullptr    Indicates not enough memory.
+     */
+    void *CAlloc(size_t aCount, size_t aSize);
+
+    /**
+     * Free memory pointed by @p aPointer.
+     *
+     * @param[in]   aPointer    A pointer to the memory to free.
+     */
+    void Free(void *aPointer);
+
+    /**
+     * Returns whether the heap is clean.
+     */
+    bool IsClean(void) const { return (mPages[0].mState == kPageFree) && (mPages[0].mRunLength == kNumPages); }
+
+    /**
+     * Returns the capacity of this heap.
+     */
+    size_t GetCapacity(void) const { return static_cast<size_t>(kNumPages) * kPageSize; }
+
+    /**
+     * Returns free space of this heap.
+     *
+     * The free space includes the unused blocks in the pages assigned to small size classes.
+     */
+    size_t GetFreeSize(void) const { return mFreeSize; }
+
+    /**
+     * Gets the information about a size class.
+     *
+     * The size classes are ordered by block size. The last one (index `kNumSizeClasses - 1`) represents the large
+     * allocations and has a block size of zero.
+     *
+     * @param[in]  aIndex  The size class index.
+     * @param[out] aInfo   A reference to return the information.
+     *
+     * @retval kErrorNone      Successfully retrieved the information.
+     * @retval kErrorNotFound  @p aIndex is not a valid size class index.
+     */
+    Error GetSizeClassInfo(uint8_t aIndex, SizeClassInfo &aInfo) const;
+
+private:
+#if OPENTHREAD_CONFIG_TLS_ENABLE || OPENTHREAD_CONFIG_SECURE_TRANSPORT_ENABLE
+    static constexpr uint32_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
+#else
+    static constexpr uint32_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS;
+#endif
+    static constexpr uint32_t kPageSize          = 512;
+    static constexpr uint32_t kNumPages          = kMemorySize / kPageSize;
+    static constexpr uint16_t kMaxSmallBlockSize = 256;
+    static constexpr uint8_t  kNumSmallClasses   = kNumSizeClasses - 1;
+    static constexpr uint8_t  kLargeSizeClass    = kNumSmallClasses;
+    static constexpr uint8_t  kNumFreeRunBins    = 16;
+    static constexpr uint16_t kNone              = 0xffff;
+
+    static_assert(kNumPages > 0, "OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE is too small for the segregated-fit heap");
+    static_assert(kNumPages < kNone, "OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE is too large for the segregated-fit heap");
+
+    static const uint16_t kSmallBlockSizes[kNumSmallClasses];
+
+    enum PageState : uint8_t
+    {
+        kPageFree,  // Part of a free run.
+        kPageLarge, // Part of a large allocation.
+        kPageSmall, // Slab of a small size class.
+    };
+
+    // `mRunLength` is valid on the first and the last page of a free
+    // or large run. `mNext` and `mPrev` link the first page of a free
+    // run in its bin, or a slab page in the list of its size class
+    // pages which have a free block. `mFreeBlock` is the index of the
+    // first free block in a slab (each free block stores the index of
+    // the next one), and `mNumCarved` the number of blocks handed out
+    // at least once.
+
+    struct Page
+    {
+        PageState mState;
+        uint8_t   mSizeClass;
+        uint16_t  mRunLength;
+        uint16_t  mNext;
+        uint16_t  mPrev;
+        uint16_t  mNumUsed;
+        uint16_t  mNumCarved;
+        uint16_t  mFreeBlock;
+    };
+
+    static uint8_t  GetSizeClass(uint32_t aSize);
+    static uint8_t  GetFreeRunBin(uint16_t aRunLength);
+    static uint16_t GetBlocksPerPage(uint8_t aSizeClass) { return kPageSize / kSmallBlockSizes[aSizeClass]; }
+
+    void    *AllocateSmall(uint8_t aSizeClass);
+    void     FreeSmall(uint16_t aPageIndex, uint32_t aPageOffset);
+    void    *AllocateLarge(uint32_t aSize);
+    uint16_t AllocatePages(uint16_t aNumPages);
+    void     FreePages(uint16_t aPageIndex, uint16_t aNumPages);
+    void     InsertFreeRun(uint16_t aPageIndex, uint16_t aNumPages);
+    void     RemoveFreeRun(uint16_t aPageIndex);
+    void     PushPage(uint16_t &aHead, uint16_t aPageIndex);
+    void     RemovePage(uint16_t &aHead, uint16_t aPageIndex);
+    void     MarkRun(uint16_t aPageIndex, uint16_t aNumPages, PageState aState);
+    uint8_t *GetPageMemory(uint16_t aPageIndex) { return &mMemory.m8[static_cast<uint32_t>(aPageIndex) * kPageSize]; }
+    uint16_t &BlockLink(uint16_t aPageIndex, uint16_t aBlockIndex, uint8_t aSizeClass);
+
+    union
+    {
+        // Make sure memory is long aligned.
+        long    mLong[kMemorySize / sizeof(long)];
+        uint8_t m8[kMemorySize];
+    } mMemory;
+
+    Page          mPages[kNumPages];
+    uint16_t      mFreeRuns[kNumFreeRunBins];
+    uint16_t      mPartialPages[kNumSmallClasses];
+    size_t        mFreeSize;
+    SizeClassInfo mSizeClassInfo[kNumSizeClasses];
+};
+
+#else // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
 /**
  * Represents a memory block.
  *
@@ -321,7 +491,14 @@ private:
     } mMemory;
 };
 
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
 } // namespace Utils
+
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+DefineCoreType(otHeapSizeClassInfo, Utils::Heap::SizeClassInfo);
+#endif
+
 } // namespace ot
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
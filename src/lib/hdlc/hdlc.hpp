@@ -171,6 +171,10 @@ private:
         kStateEscaped,
     };
 
+    void DecodeRun(const uint8_t *aData, uint16_t aLength);
+
+    static const uint8_t *FindFlagOrEscape(const uint8_t *aData, const uint8_t *aEnd);
+
     State                      mState;
     Spinel::FrameWritePointer *mWritePointer;
     FrameHandler               mFrameHandler;
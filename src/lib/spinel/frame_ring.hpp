@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ *    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the single-producer/single-consumer spinel frame ring.
+ */
+
+#ifndef OT_LIB_SPINEL_FRAME_RING_HPP_
+#define OT_LIB_SPINEL_FRAME_RING_HPP_
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/error.h>
+
+#include "common/code_utils.hpp"
+#include "lib/spinel/multi_frame_buffer.hpp"
+
+namespace ot {
+namespace Spinel {
+
+/**
+ * Implements a lock-free ring buffer of spinel frames shared between one producer thread and one consumer thread.
+ *
+ * `Push()` must only be called from the producer thread and `Pop()`/`HasFrame()` only from the consumer thread.
+ * `GetUsedSize()` can be called from either thread. `Clear()` must only be called when neither thread is using the
+ * ring.
+ *
+ * Each frame is stored as a 2-byte little-endian length followed by the frame bytes. A frame may wrap around the end
+ * of the buffer.
+ *
+ * @tparam kSize  The ring buffer size in bytes. MUST be a power of two.
+ */
+template <uint32_t kSize> class FrameRing
+{
+    static_assert((kSize != 0) && ((kSize & (kSize - 1)) == 0), "FrameRing size MUST be a power of two");
+    static_assert(kSize <= (1UL << 31), "FrameRing size is too large");
+
+public:
+    /**
+     * Initializes the `FrameRing` as empty.
+     */
+    FrameRing(void)
+        : mHead(0)
+        , mTail(0)
+    {
+    }
+
+    /**
+     * Clears the ring, discarding all frames.
+     */
+    void Clear(void)
+    {
+        mHead.store(0, std::memory_order_relaxed);
+        mTail.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Appends a frame to the ring (producer thread).
+     *
+     * @param[in] aFrame   A pointer to the frame.
+     * @param[in] aLength  The frame length (number of bytes).
+     *
+     * @retval OT_ERROR_NONE     The frame was appended.
+     * @retval OT_ERROR_NO_BUFS  There is not enough free space in the ring for the frame.
+     */
+    otError Push(const uint8_t *aFrame, uint16_t aLength)
+    {
+        otError  error = OT_ERROR_NONE;
+        uint32_t tail  = mTail.load(std::memory_order_relaxed);
+        uint32_t head  = mHead.load(std::memory_order_acquire);
+        uint8_t  header[kHeaderSize];
+
+        VerifyOrExit(kSize - (tail - head) >= kHeaderSize + static_cast<uint32_t>(aLength), error = OT_ERROR_NO_BUFS);
+
+        header[0] = static_cast<uint8_t>(aLength & 0xff);
+        header[1] = static_cast<uint8_t>(aLength >> 8);
+
+        Write(tail, header, kHeaderSize);
+        Write(tail + kHeaderSize, aFrame, aLength);
+
+        mTail.store(tail + kHeaderSize + aLength, std::memory_order_release);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Indicates whether or not the ring contains a frame (consumer thread).
+     *
+     * @retval TRUE   The ring contains at least one frame.
+     * @retval FALSE  The ring is empty.
+     */
+    bool HasFrame(void) const
+    {
+        return mHead.load(std::memory_order_relaxed) != mTail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Removes the oldest frame from the ring and writes it using a given `FrameWritePointer` (consumer thread).
+     *
+     * If @p aWritePointer cannot fit the frame, the frame is still removed from the ring and `OT_ERROR_NO_BUFS` is
+     * returned.
+     *
+     * @param[in] aWritePointer  The `FrameWritePointer` to write the frame to.
+     *
+     * @retval OT_ERROR_NONE       The frame was removed and written to @p aWritePointer.
+     * @retval OT_ERROR_NOT_FOUND  The ring is empty.
+     * @retval OT_ERROR_NO_BUFS    The frame was removed but did not fit in @p aWritePointer.
+     */
+    otError Pop(FrameWritePointer &aWritePointer)
+    {
+        otError  error = OT_ERROR_NONE;
+        uint32_t head  = mHead.load(std::memory_order_relaxed);
+        uint32_t tail  = mTail.load(std::memory_order_acquire);
+        uint8_t  header[kHeaderSize];
+        uint16_t length;
+        uint32_t offset;
+
+        VerifyOrExit(head != tail, error = OT_ERROR_NOT_FOUND);
+
+        Read(head, header, kHeaderSize);
+        length = static_cast<uint16_t>(header[0] | (header[1] << 8));
+        offset = head + kHeaderSize;
+
+        if (!aWritePointer.CanWrite(length))
+        {
+            error = OT_ERROR_NO_BUFS;
+        }
+        else
+        {
+            // The frame may wrap around, so it is written in (at
+            // most) two contiguous segments.
+
+            uint32_t index        = offset & kIndexMask;
+            uint16_t firstSegment = static_cast<uint16_t>((kSize - index < length) ? (kSize - index) : length);
+
+            IgnoreError(aWritePointer.WriteBytes(&mBuffer[index], firstSegment));
+            IgnoreError(aWritePointer.WriteBytes(&mBuffer[0], length - firstSegment));
+        }
+
+        mHead.store(offset + length, std::memory_order_release);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Returns the number of bytes currently used in the ring, including the per-frame headers.
+     *
+     * @returns The number of used bytes.
+     */
+    uint32_t GetUsedSize(void) const
+    {
+        return mTail.load(std::memory_order_acquire) - mHead.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr uint32_t kHeaderSize = sizeof(uint16_t);
+    static constexpr uint32_t kIndexMask  = kSize - 1;
+
+    void Write(uint32_t aOffset, const uint8_t *aData, uint32_t aLength)
+    {
+        uint32_t index        = aOffset & kIndexMask;
+        uint32_t firstSegment = (kSize - index < aLength) ? (kSize - index) : aLength;
+
+        memcpy(&mBuffer[index], aData, firstSegment);
+        memcpy(&mBuffer[0], aData + firstSegment, aLength - firstSegment);
+    }
+
+    void Read(uint32_t aOffset, uint8_t *aData, uint32_t aLength) const
+    {
+        uint32_t index        = aOffset & kIndexMask;
+        uint32_t firstSegment = (kSize - index < aLength) ? (kSize - index) : aLength;
+
+        memcpy(aData, &mBuffer[index], firstSegment);
+        memcpy(aData + firstSegment, &mBuffer[0], aLength - firstSegment);
+    }
+
+    // `mHead` is only written by the consumer and `mTail` only by
+    // the producer. Both are free-running and wrap around at 2^32,
+    // the index into `mBuffer` is taken modulo `kSize`.
+
+    std::atomic<uint32_t> mHead;
+    std::atomic<uint32_t> mTail;
+    uint8_t               mBuffer[kSize];
+};
+
+} // namespace Spinel
+} // namespace ot
+
+#endif // OT_LIB_SPINEL_FRAME_RING_HPP_
@@ -86,6 +86,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * Either all of the bytes are written or, if there is not enough space, none of them.
+     *
+     * @param[in]  aData    A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  The number of bytes in @p aData.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(CanWrite(aLength), error = OT_ERROR_NO_BUFS);
+        VerifyOrExit(aLength > 0);
+
+        memcpy(mWritePointer, aData, aLength);
+        mWritePointer += aLength;
+        mRemainingLength -= aLength;
+
+    exit:
+        return error;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
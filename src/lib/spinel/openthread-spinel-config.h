@@ -69,6 +69,18 @@
 #define OPENTHREAD_LIB_SPINEL_NCP_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_ENABLE
+ *
+ * Define as 1 to compute the HDLC FCS eight bytes at a time using slicing-by-8 lookup tables.
+ *
+ * This speeds up HDLC encoding and decoding of large frames at the cost of 3.5 KiB of additional constant tables. The
+ * POSIX platform enables it in its lib config header.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICING_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
  *
@@ -75,6 +75,8 @@ RadioSpinel::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mAsyncTids(0)
+    , mAsyncError(OT_ERROR_NONE)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -415,6 +417,10 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+    else if ((mAsyncTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandleAsyncResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
     else
     {
         LogWarn("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -495,6 +501,41 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleAsyncResponse(spinel_tid_t      aTid,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aBuffer,
+                                      uint16_t          aLength)
+{
+    const AsyncRequest &request = mAsyncRequests[aTid];
+    otError             error   = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    mAsyncTids &= ~(1 << aTid);
+    FreeTid(aTid);
+
+    if (mAsyncError == OT_ERROR_NONE)
+    {
+        mAsyncError = error;
+    }
+
+    UpdateParseErrorCount(error);
+    LogIfFail("Error processing pipelined result", error);
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError        error = OT_ERROR_NONE;
@@ -1430,6 +1471,109 @@ exit:
     return mError;
 }
 
+void RadioSpinel::SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    RequestAsyncV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+    va_end(args);
+}
+
+void RadioSpinel::InsertAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    RequestAsyncV(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT, aKey, aFormat, args);
+    va_end(args);
+}
+
+void RadioSpinel::RequestAsyncV(uint32_t          aExpectedCommand,
+                                uint32_t          aCommand,
+                                spinel_prop_key_t aKey,
+                                const char       *aFormat,
+                                va_list           aArgs)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid;
+
+    // Do not send the rest of the batch once a pipelined request has failed.
+    VerifyOrExit(mAsyncError == OT_ERROR_NONE);
+
+    tid = GetNextTid();
+
+    if (tid == 0 && mAsyncTids != 0)
+    {
+        // All transaction ids are in use, wait for an earlier pipelined request to complete.
+        SuccessOrExit(error = WaitAsyncResponses(/* aWaitAll */ false));
+        tid = GetNextTid();
+    }
+
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = GetSpinelDriver().SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mAsyncRequests[tid].mKey             = aKey;
+    mAsyncRequests[tid].mExpectedCommand = aExpectedCommand;
+    mAsyncTids |= (1 << tid);
+
+exit:
+    if (mAsyncError == OT_ERROR_NONE)
+    {
+        mAsyncError = error;
+    }
+}
+
+otError RadioSpinel::WaitAsyncResponses(bool aWaitAll)
+{
+    uint64_t end     = otPlatTimeGet() + kMaxWaitTime * kUsPerMs;
+    uint16_t pending = mAsyncTids;
+    otError  error   = OT_ERROR_NONE;
+
+    LogDebg("Wait pipelined responses: tids=0x%04x", mAsyncTids);
+
+    while (mAsyncTids != 0 && (aWaitAll || mAsyncTids == pending))
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (GetSpinelDriver().GetSpinelInterface()->WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            LogWarn("Wait for pipelined responses timeout");
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        if (mRcpFailure != kRcpFailureNone)
+        {
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+#endif
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        // Responses to the outstanding requests are not expected anymore.
+        mCmdTidsInUse &= ~mAsyncTids;
+        mAsyncTids  = 0;
+        mAsyncError = OT_ERROR_NONE;
+    }
+    else if (aWaitAll)
+    {
+        error       = mAsyncError;
+        mAsyncError = OT_ERROR_NONE;
+    }
+
+    return error;
+}
+
 spinel_tid_t RadioSpinel::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -2094,7 +2238,9 @@ void RadioSpinel::RecoverFromRcpFailure(void)
     mCmdNextTid   = 1;
     mTxRadioTid   = 0;
     mWaitingTid   = 0;
+    mAsyncTids    = 0;
     mError        = OT_ERROR_NONE;
+    mAsyncError   = OT_ERROR_NONE;
     mIsTimeSynced = false;
 
     SuccessOrDie(Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
@@ -2177,23 +2323,28 @@ void RadioSpinel::HandleSavedFrame(const uint8_t *aFrame, uint16_t aLength) { Ha
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 void RadioSpinel::RestoreProperties(void)
 {
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
+    otError error;
+
+    // The properties are restored with pipelined requests and a single wait for all the responses, so restoring
+    // the source match tables does not take a round-trip per entry.
+
+    SetAsync(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId);
+    SetAsync(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress);
+    SetAsync(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8);
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     // In case multiple PANs are running, don't force RCP to change channel.
     IgnoreReturnValue(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
 #else
-    SuccessOrDie(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    SetAsync(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel);
 #endif
 
     if (mMacKeySet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_KEY,
-                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                         mKeyIdMode, mKeyIndex, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey),
-                         mNextKey.m8, sizeof(otMacKey)));
+        SetAsync(SPINEL_PROP_RCP_MAC_KEY,
+                 SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S
+                     SPINEL_DATATYPE_DATA_WLEN_S,
+                 mKeyIdMode, mKeyIndex, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
+                 sizeof(otMacKey));
     }
 
     if (mMacFrameCounterSet)
@@ -2210,51 +2361,65 @@ void RadioSpinel::RestoreProperties(void)
         // CounterGuard: 2000ms(Timeout) / [(28bytes(Data) + 29bytes(Ack)) * 32us/byte + 192us(Ifs)] = 992
         static constexpr uint16_t kFrameCounterGuard = 1000;
 
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S,
-                         otLinkGetFrameCounter(mInstance) + kFrameCounterGuard));
+        SetAsync(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S,
+                 otLinkGetFrameCounter(mInstance) + kFrameCounterGuard);
     }
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
+    SetAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr);
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
+        InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]);
     }
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
+    SetAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr);
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
+        InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8);
     }
 
     if (mSrcMatchSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled));
+        SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled);
     }
 
     if (mCcaEnergyDetectThresholdSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
+        SetAsync(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold);
     }
 
     if (mTransmitPowerSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
+        SetAsync(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower);
     }
 
     if (mCoexEnabledSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
+        SetAsync(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled);
     }
 
     if (mFemLnaGainSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
+        SetAsync(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain);
+    }
+
+    if ((sRadioCaps & OT_RADIO_CAPS_RX_ON_WHEN_IDLE) != 0)
+    {
+        SetAsync(SPINEL_PROP_MAC_RX_ON_WHEN_IDLE_MODE, SPINEL_DATATYPE_BOOL_S, mRxOnWhenIdle);
+    }
+
+    error = WaitAsyncResponses();
+
+    if (mRcpFailure != kRcpFailureNone)
+    {
+        // The RCP failed again while being restored, start over.
+        RecoverFromRcpFailure();
+        ExitNow();
     }
 
+    SuccessOrDie(error);
+
 #if OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
     for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
     {
@@ -2263,7 +2428,7 @@ void RadioSpinel::RestoreProperties(void)
         if (power != OT_RADIO_POWER_INVALID)
         {
             // Some old RCPs doesn't support max transmit power
-            otError error = SetChannelMaxTransmitPower(channel, power);
+            error = SetChannelMaxTransmitPower(channel, power);
 
             if (error != OT_ERROR_NONE && error != OT_ERROR_NOT_FOUND)
             {
@@ -2273,11 +2438,6 @@ void RadioSpinel::RestoreProperties(void)
     }
 #endif // OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
 
-    if ((sRadioCaps & OT_RADIO_CAPS_RX_ON_WHEN_IDLE) != 0)
-    {
-        SuccessOrDie(Set(SPINEL_PROP_MAC_RX_ON_WHEN_IDLE_MODE, SPINEL_DATATYPE_BOOL_S, mRxOnWhenIdle));
-    }
-
 #if OPENTHREAD_SPINEL_CONFIG_VENDOR_HOOK_ENABLE
     if (mVendorRestorePropertiesCallback)
     {
@@ -2289,6 +2449,9 @@ void RadioSpinel::RestoreProperties(void)
     {
         CalcRcpTimeOffset();
     }
+
+exit:
+    return;
 }
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
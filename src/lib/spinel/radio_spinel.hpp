@@ -1105,6 +1105,8 @@ private:
     static constexpr uint64_t kTxWaitUs =
         OPENTHREAD_SPINEL_CONFIG_RCP_TX_WAIT_TIME_SECS *
         kUsPerSec; ///< Maximum time of waiting for `TransmitDone` event, in microseconds.
+    static constexpr uint8_t kNumTids =
+        (SPINEL_HEADER_TID_MASK >> SPINEL_HEADER_TID_SHIFT) + 1; ///< Number of spinel transaction ids.
 
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
@@ -1146,6 +1148,21 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
+
+    /**
+     * Pipelined requests are sent without waiting for the previous response, keeping up to one request per free
+     * transaction id in flight. The RCP handles the requests in order. The first error of the pipelined requests is
+     * reported by `WaitAsyncResponses()`, and once a request fails the rest of the batch is not sent.
+     */
+    void    SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+    void    InsertAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+    void    RequestAsyncV(uint32_t          aExpectedCommand,
+                          uint32_t          aCommand,
+                          spinel_prop_key_t aKey,
+                          const char       *aFormat,
+                          va_list           aArgs);
+    otError WaitAsyncResponses(bool aWaitAll = true);
+
     otError ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength, spinel_ssize_t &aUnpacked);
 
     /**
@@ -1170,6 +1187,11 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleAsyncResponse(spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t    *aBuffer,
+                             uint16_t          aLength);
 
     void RadioReceive(void);
 
@@ -1262,6 +1284,17 @@ private:
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
+
+    struct AsyncRequest
+    {
+        spinel_prop_key_t mKey;             ///< The property key of the pipelined request.
+        uint32_t          mExpectedCommand; ///< Expected response command of the pipelined request.
+    };
+
+    uint16_t     mAsyncTids;               ///< Transaction ids of pipelined requests awaiting a response.
+    otError      mAsyncError;              ///< The first error of the pipelined requests since the last wait.
+    AsyncRequest mAsyncRequests[kNumTids]; ///< The pipelined requests, indexed by transaction id.
+
     uint8_t           mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t           mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t           mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -65,6 +65,8 @@ typedef struct otRcpInterfaceMetrics
     uint64_t mRxFrameByteCount;             ///< The number of received bytes.
     uint64_t mTxFrameCount;                 ///< The number of transmitted frames.
     uint64_t mTxFrameByteCount;             ///< The number of transmitted bytes.
+    uint64_t mRxRingOverflowFrameCount;     ///< The number of received frames dropped as the I/O thread ring was full.
+    uint32_t mRxRingMaxUsedSize;            ///< The maximum number of bytes used in the I/O thread ring.
 } otRcpInterfaceMetrics;
 
 #ifdef __cplusplus
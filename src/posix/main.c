@@ -359,15 +359,48 @@ void otPlatReset(otInstance *aInstance)
     assert(false);
 }
 
+static void OutputNetifTunCounters(void)
+{
+    const otSysNetifTunCounters *counters = otSysGetNetifTunCounters();
+
+    otCliOutputFormat("ReadWakeups: %lu\r\n", (unsigned long)counters->mReadWakeups);
+    otCliOutputFormat("ReadPackets: %lu\r\n", (unsigned long)counters->mReadPackets);
+    otCliOutputFormat("MaxReadPacketsPerWakeup: %lu\r\n", (unsigned long)counters->mMaxReadPacketsPerWakeup);
+    otCliOutputFormat("WritePackets: %lu\r\n", (unsigned long)counters->mWritePackets);
+    otCliOutputFormat("WriteFailures: %lu\r\n", (unsigned long)counters->mWriteFailures);
+}
+
 static otError ProcessNetif(void *aContext, uint8_t aArgsLength, char *aArgs[])
 {
+    otError error = OT_ERROR_NONE;
+
     OT_UNUSED_VARIABLE(aContext);
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
 
-    otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    if (aArgsLength == 0)
+    {
+        otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    }
+    else if (strcmp(aArgs[0], "counters") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            OutputNetifTunCounters();
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otSysResetNetifTunCounters();
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_COMMAND;
+    }
 
-    return OT_ERROR_NONE;
+    return error;
 }
 
 #if !OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
@@ -115,8 +115,7 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
     if (rval < 0)
     {
         LogWarn("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
 
 exit:
@@ -149,11 +148,9 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-    }
+    CloseSessionSocket();
     mSessionSocket = newSessionSocket;
+    UpdatePollFds();
 
 exit:
     if (rval == -1)
@@ -288,6 +285,10 @@ exit:
     otSysCliInitUsingDaemon(gInstance);
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    SetPollFds(mPollFds, kNumPollFds);
+#endif
+    UpdatePollFds();
     Mainloop::Manager::Get().Add(*this);
 
     return;
@@ -297,11 +298,7 @@ void Daemon::TearDown(void)
 {
     Mainloop::Manager::Get().Remove(*this);
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-        mSessionSocket = -1;
-    }
+    CloseSessionSocket();
 
 #if !OPENTHREAD_POSIX_CONFIG_ANDROID_ENABLE
     // The `mListenSocket` is managed by `init` on Android
@@ -309,6 +306,7 @@ void Daemon::TearDown(void)
     {
         close(mListenSocket);
         mListenSocket = -1;
+        UpdatePollFds();
     }
 
     if (gPlatResetReason != OT_PLAT_RESET_REASON_SOFTWARE)
@@ -329,6 +327,70 @@ void Daemon::TearDown(void)
 #endif
 }
 
+void Daemon::CloseSessionSocket(void)
+{
+    VerifyOrExit(mSessionSocket != -1);
+
+    close(mSessionSocket);
+    mSessionSocket = -1;
+    UpdatePollFds();
+
+exit:
+    return;
+}
+
+void Daemon::UpdatePollFds(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    mPollFds[kListenPollFd].Set(mListenSocket, POLLIN | POLLPRI);
+    mPollFds[kSessionPollFd].Set(mSessionSocket, POLLIN | POLLPRI);
+#endif
+}
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+const Mainloop::PollFd *Daemon::FindPollFd(int aSocket) const
+{
+    const Mainloop::PollFd *pollFd = nullptr;
+
+    for (const Mainloop::PollFd &entry : mPollFds)
+    {
+        if (entry.IsInUse() && entry.fd == aSocket)
+        {
+            ExitNow(pollFd = &entry);
+        }
+    }
+
+exit:
+    return pollFd;
+}
+#endif
+
+bool Daemon::IsSocketReadable(int aSocket, const Mainloop::Context &aContext) const
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    const Mainloop::PollFd *pollFd = FindPollFd(aSocket);
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    return (pollFd != nullptr) && pollFd->IsReadable();
+#else
+    return Mainloop::IsFdReadable(aSocket, aContext);
+#endif
+}
+
+bool Daemon::HasSocketErrored(int aSocket, const Mainloop::Context &aContext) const
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    const Mainloop::PollFd *pollFd = FindPollFd(aSocket);
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    return (pollFd != nullptr) && pollFd->HasErrored();
+#else
+    return Mainloop::HasFdErrored(aSocket, aContext);
+#endif
+}
+
 void Daemon::Update(Mainloop::Context &aContext)
 {
     Mainloop::AddToReadFdSet(mListenSocket, aContext);
@@ -344,23 +406,22 @@ void Daemon::Process(const Mainloop::Context &aContext)
 
     VerifyOrExit(mListenSocket != -1);
 
-    if (Mainloop::HasFdErrored(mListenSocket, aContext))
+    if (HasSocketErrored(mListenSocket, aContext))
     {
         DieNowWithMessage("daemon socket error", OT_EXIT_FAILURE);
     }
-    else if (Mainloop::IsFdReadable(mListenSocket, aContext))
+    else if (IsSocketReadable(mListenSocket, aContext))
     {
         InitializeSessionSocket();
     }
 
     VerifyOrExit(mSessionSocket != -1);
 
-    if (Mainloop::HasFdErrored(mSessionSocket, aContext))
+    if (HasSocketErrored(mSessionSocket, aContext))
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
-    else if (Mainloop::IsFdReadable(mSessionSocket, aContext))
+    else if (IsSocketReadable(mSessionSocket, aContext))
     {
         uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
 
@@ -382,8 +443,7 @@ void Daemon::Process(const Mainloop::Context &aContext)
             {
                 LogWarn("Daemon read: %s", strerror(errno));
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
+            CloseSessionSocket();
         }
     }
 
@@ -59,10 +59,28 @@ private:
     int  OutputFormat(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
     void createListenSocketOrDie(void);
     void InitializeSessionSocket(void);
+    void CloseSessionSocket(void);
+    void UpdatePollFds(void);
+    bool IsSocketReadable(int aSocket, const Mainloop::Context &aContext) const;
+    bool HasSocketErrored(int aSocket, const Mainloop::Context &aContext) const;
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    enum : uint8_t
+    {
+        kListenPollFd,
+        kSessionPollFd,
+        kNumPollFds,
+    };
+
+    const Mainloop::PollFd *FindPollFd(int aSocket) const;
+#endif
 
     int mListenSocket  = -1;
     int mDaemonLock    = -1;
     int mSessionSocket = -1;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    Mainloop::PollFd mPollFds[kNumPollFds];
+#endif
 };
 
 } // namespace Posix
@@ -47,6 +47,9 @@
 #include <pty.h>
 #endif
 #endif
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <signal.h>
+#endif
 #include <stdarg.h>
 #include <stdlib.h>
 #include <sys/file.h>
@@ -126,11 +129,43 @@
 
 #if OPENTHREAD_POSIX_CONFIG_SPINEL_HDLC_INTERFACE_ENABLE
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE && OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE is not supported with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+
 namespace ot {
 namespace Posix {
 
 const char HdlcInterface::kLogModuleName[] = "HdlcIntface";
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+static void OpenPipe(int aPipe[2])
+{
+    VerifyOrDie(pipe(aPipe) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int i = 0; i < 2; i++)
+    {
+        int flags = fcntl(aPipe[i], F_GETFL);
+
+        VerifyOrDie(flags != -1, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(aPipe[i], F_SETFL, flags | O_NONBLOCK) != -1, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(aPipe[i], F_SETFD, FD_CLOEXEC) != -1, OT_EXIT_ERROR_ERRNO);
+    }
+}
+
+static void ClosePipe(int aPipe[2])
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (aPipe[i] != -1)
+        {
+            close(aPipe[i]);
+            aPipe[i] = -1;
+        }
+    }
+}
+#endif
+
 HdlcInterface::HdlcInterface(const Url::Url &aRadioUrl)
     : mReceiveFrameCallback(nullptr)
     , mReceiveFrameContext(nullptr)
@@ -139,9 +174,20 @@ HdlcInterface::HdlcInterface(const Url::Url &aRadioUrl)
     , mBaudRate(0)
     , mHdlcDecoder()
     , mRadioUrl(aRadioUrl)
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    , mIoThreadRunning(false)
+    , mRxRingOverflowCount(0)
+    , mRxGarbageCount(0)
+    , mRxRingMaxUsedSize(0)
+#endif
 {
     memset(&mInterfaceMetrics, 0, sizeof(mInterfaceMetrics));
     mInterfaceMetrics.mRcpInterfaceType = kSpinelInterfaceTypeHdlc;
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    mNotifyPipe[0] = mNotifyPipe[1] = -1;
+    mStopPipe[0]   = mStopPipe[1] = -1;
+#endif
 }
 
 otError HdlcInterface::Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer)
@@ -171,11 +217,21 @@ otError HdlcInterface::Init(ReceiveFrameCallback aCallback, void *aCallbackConte
         ExitNow(error = OT_ERROR_FAILED);
     }
 
-    mHdlcDecoder.Init(aFrameBuffer, HandleHdlcFrame, this);
     mReceiveFrameCallback = aCallback;
     mReceiveFrameContext  = aCallbackContext;
     mReceiveFrameBuffer   = &aFrameBuffer;
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    OpenPipe(mNotifyPipe);
+    OpenPipe(mStopPipe);
+    mRxRing.Clear();
+    mIoFrameBuffer.Clear();
+    mHdlcDecoder.Init(mIoFrameBuffer, HandleIoHdlcFrame, this);
+    StartIoThread();
+#else
+    mHdlcDecoder.Init(aFrameBuffer, HandleHdlcFrame, this);
+#endif
+
 exit:
     return error;
 }
@@ -184,8 +240,17 @@ HdlcInterface::~HdlcInterface(void) { Deinit(); }
 
 void HdlcInterface::Deinit(void)
 {
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    StopIoThread();
+#endif
+
     CloseFile();
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    ClosePipe(mNotifyPipe);
+    ClosePipe(mStopPipe);
+#endif
+
     mReceiveFrameCallback = nullptr;
     mReceiveFrameContext  = nullptr;
     mReceiveFrameBuffer   = nullptr;
@@ -229,8 +294,18 @@ otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
 exit:
     if ((error == OT_ERROR_NONE) && IsSpinelResetCommand(aFrame, aLength))
     {
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+        StopIoThread();
+        mIoFrameBuffer.Clear();
+#endif
         mHdlcDecoder.Reset();
         error = ResetConnection();
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+        if (mSockFd != -1)
+        {
+            StartIoThread();
+        }
+#endif
     }
 
     return error;
@@ -308,6 +383,33 @@ otError HdlcInterface::WaitForFrame(uint64_t aTimeoutUs)
         assert(false);
         break;
     }
+#elif OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    fd_set read_fds;
+    int    rval;
+
+    VerifyOrExit(!ProcessRxRing());
+
+    timeout.tv_sec  = static_cast<time_t>(aTimeoutUs / OT_US_PER_S);
+    timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % OT_US_PER_S);
+
+    FD_ZERO(&read_fds);
+    FD_SET(mNotifyPipe[0], &read_fds);
+
+    rval = select(mNotifyPipe[0] + 1, &read_fds, nullptr, nullptr, &timeout);
+
+    if (rval > 0)
+    {
+        ClearRxNotify();
+        IgnoreReturnValue(ProcessRxRing());
+    }
+    else if (rval == 0)
+    {
+        ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+    }
+    else if (errno != EINTR)
+    {
+        DieNowWithMessage("wait response", OT_EXIT_FAILURE);
+    }
 #else  // OPENTHREAD_POSIX_VIRTUAL_TIME
     timeout.tv_sec  = static_cast<time_t>(aTimeoutUs / OT_US_PER_S);
     timeout.tv_usec = static_cast<suseconds_t>(aTimeoutUs % OT_US_PER_S);
@@ -358,12 +460,28 @@ void HdlcInterface::UpdateFdSet(void *aMainloopContext)
 
     assert(context != nullptr);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    if (mRxRing.HasFrame())
+    {
+        // Frames are already queued, so the mainloop should not block.
+        context->mTimeout.tv_sec  = 0;
+        context->mTimeout.tv_usec = 0;
+    }
+
+    FD_SET(mNotifyPipe[0], &context->mReadFdSet);
+
+    if (context->mMaxFd < mNotifyPipe[0])
+    {
+        context->mMaxFd = mNotifyPipe[0];
+    }
+#else
     FD_SET(mSockFd, &context->mReadFdSet);
 
     if (context->mMaxFd < mSockFd)
     {
         context->mMaxFd = mSockFd;
     }
+#endif
 }
 
 void HdlcInterface::Process(const void *aMainloopContext)
@@ -385,11 +503,20 @@ void HdlcInterface::Process(const void *aMainloopContext)
 
     assert(context != nullptr);
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    if (FD_ISSET(mNotifyPipe[0], &context->mReadFdSet))
+    {
+        ClearRxNotify();
+    }
+
+    IgnoreReturnValue(ProcessRxRing());
+#else
     if (FD_ISSET(mSockFd, &context->mReadFdSet))
     {
         Read();
     }
 #endif
+#endif
 }
 
 otError HdlcInterface::WaitForWritable(void)
@@ -762,6 +889,161 @@ exit:
     return;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+void HdlcInterface::StartIoThread(void)
+{
+    sigset_t blockSet;
+    sigset_t oldSet;
+
+    // Block all signals while creating the thread so that it inherits
+    // the blocked mask and signals are only handled by the mainloop.
+
+    sigfillset(&blockSet);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &blockSet, &oldSet) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_create(&mIoThread, nullptr, IoThreadMain, this) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(pthread_sigmask(SIG_SETMASK, &oldSet, nullptr) == 0, OT_EXIT_FAILURE);
+
+    mIoThreadRunning = true;
+}
+
+void HdlcInterface::StopIoThread(void)
+{
+    uint8_t byte = 0;
+
+    VerifyOrExit(mIoThreadRunning);
+
+    VerifyOrDie(write(mStopPipe[1], &byte, sizeof(byte)) == sizeof(byte), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(pthread_join(mIoThread, nullptr) == 0, OT_EXIT_FAILURE);
+    VerifyOrDie(read(mStopPipe[0], &byte, sizeof(byte)) == sizeof(byte), OT_EXIT_ERROR_ERRNO);
+
+    mIoThreadRunning = false;
+
+exit:
+    return;
+}
+
+void *HdlcInterface::IoThreadMain(void *aContext)
+{
+    static_cast<HdlcInterface *>(aContext)->IoThreadMain();
+    return nullptr;
+}
+
+void HdlcInterface::IoThreadMain(void)
+{
+    while (true)
+    {
+        fd_set readFds;
+        fd_set errorFds;
+        int    maxFd = OT_MAX(mSockFd, mStopPipe[0]);
+        int    rval;
+
+        FD_ZERO(&readFds);
+        FD_ZERO(&errorFds);
+        FD_SET(mSockFd, &readFds);
+        FD_SET(mSockFd, &errorFds);
+        FD_SET(mStopPipe[0], &readFds);
+
+        rval = select(maxFd + 1, &readFds, nullptr, &errorFds, nullptr);
+
+        if (rval < 0)
+        {
+            VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+            continue;
+        }
+
+        if (FD_ISSET(mStopPipe[0], &readFds))
+        {
+            break;
+        }
+
+        if (FD_ISSET(mSockFd, &errorFds))
+        {
+            DieNowWithMessage("NCP error", OT_EXIT_FAILURE);
+        }
+
+        if (FD_ISSET(mSockFd, &readFds))
+        {
+            Read();
+        }
+    }
+}
+
+void HdlcInterface::HandleIoHdlcFrame(void *aContext, otError aError)
+{
+    static_cast<HdlcInterface *>(aContext)->HandleIoHdlcFrame(aError);
+}
+
+void HdlcInterface::HandleIoHdlcFrame(otError aError)
+{
+    // Runs on the I/O thread. Only the atomic counters are updated
+    // here, they are folded into `mInterfaceMetrics` by the
+    // OpenThread thread in `UpdateRxRingMetrics()`.
+
+    if (aError != OT_ERROR_NONE)
+    {
+        mRxGarbageCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (mRxRing.Push(mIoFrameBuffer.GetFrame(), mIoFrameBuffer.GetLength()) != OT_ERROR_NONE)
+    {
+        mRxRingOverflowCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        uint8_t  byte     = 0;
+        uint32_t usedSize = mRxRing.GetUsedSize();
+
+        if (usedSize > mRxRingMaxUsedSize.load(std::memory_order_relaxed))
+        {
+            mRxRingMaxUsedSize.store(usedSize, std::memory_order_relaxed);
+        }
+
+        // A full pipe already has a pending notification.
+        if ((write(mNotifyPipe[1], &byte, sizeof(byte)) < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            DieNow(OT_EXIT_ERROR_ERRNO);
+        }
+    }
+
+    mIoFrameBuffer.Clear();
+}
+
+void HdlcInterface::ClearRxNotify(void)
+{
+    uint8_t buffer[64];
+
+    while (read(mNotifyPipe[0], buffer, sizeof(buffer)) > 0)
+    {
+    }
+}
+
+bool HdlcInterface::ProcessRxRing(void)
+{
+    bool processed = false;
+
+    UpdateRxRingMetrics();
+
+    while ((mReceiveFrameBuffer != nullptr) && mRxRing.HasFrame())
+    {
+        otError error = mRxRing.Pop(*mReceiveFrameBuffer);
+
+        processed = true;
+        HandleHdlcFrame(error);
+    }
+
+    return processed;
+}
+
+void HdlcInterface::UpdateRxRingMetrics(void)
+{
+    uint32_t garbageCount = mRxGarbageCount.exchange(0, std::memory_order_relaxed);
+
+    mInterfaceMetrics.mTransferredFrameCount += garbageCount;
+    mInterfaceMetrics.mTransferredGarbageFrameCount += garbageCount;
+    mInterfaceMetrics.mRxRingOverflowFrameCount += mRxRingOverflowCount.exchange(0, std::memory_order_relaxed);
+    mInterfaceMetrics.mRxRingMaxUsedSize = mRxRingMaxUsedSize.load(std::memory_order_relaxed);
+}
+#endif // OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+
 otError HdlcInterface::ResetConnection(void)
 {
     otError  error = OT_ERROR_NONE;
@@ -34,10 +34,19 @@
 #ifndef OT_POSIX_PLATFORM_HDLC_INTERFACE_HPP_
 #define OT_POSIX_PLATFORM_HDLC_INTERFACE_HPP_
 
-#include "logger.hpp"
 #include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include <atomic>
+#include <pthread.h>
+#endif
+
+#include "logger.hpp"
 #include "platform-posix.h"
 #include "lib/hdlc/hdlc.hpp"
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#include "lib/spinel/frame_ring.hpp"
+#endif
 #include "lib/spinel/multi_frame_buffer.hpp"
 #include "lib/spinel/openthread-spinel-config.h"
 #include "lib/spinel/spinel_interface.hpp"
@@ -230,6 +239,33 @@ private:
     static int ForkPty(const Url::Url &aRadioUrl);
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    /**
+     * Starts the I/O thread which reads and decodes the data received from the RCP into `mRxRing`.
+     */
+    void StartIoThread(void);
+
+    /**
+     * Stops the I/O thread and waits for it to exit.
+     */
+    void StopIoThread(void);
+
+    /**
+     * Passes the frames queued in `mRxRing` by the I/O thread to the `aCallback` from `Init()`.
+     *
+     * @retval TRUE   At least one frame was processed.
+     * @retval FALSE  The ring was empty.
+     */
+    bool ProcessRxRing(void);
+
+    void        ClearRxNotify(void);
+    void        UpdateRxRingMetrics(void);
+    static void HandleIoHdlcFrame(void *aContext, otError aError);
+    void        HandleIoHdlcFrame(otError aError);
+    static void *IoThreadMain(void *aContext);
+    void         IoThreadMain(void);
+#endif
+
     static constexpr uint16_t kMaxWaitTime    = 2000; ///< Max wait time in msec for socket to become writable.
     static constexpr uint16_t kResetTimeout   = 5000; ///< Max wait time in msec for file to become ready.
     static constexpr uint16_t kOpenFileDelay  = 50;   ///< Delay between open file calls, in msec.
@@ -246,6 +282,25 @@ private:
 
     otRcpInterfaceMetrics mInterfaceMetrics;
 
+#if OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+    // `mIoFrameBuffer`, `mHdlcDecoder` and reads from `mSockFd` are
+    // owned by the I/O thread while it runs. The decoded frames are
+    // passed to the OpenThread thread through `mRxRing`, and a byte
+    // is written to `mNotifyPipe` to wake up its mainloop.
+
+    typedef Spinel::FrameRing<OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_RING_SIZE> RxRing;
+
+    pthread_t                          mIoThread;
+    bool                               mIoThreadRunning;
+    int                                mNotifyPipe[2];
+    int                                mStopPipe[2];
+    Spinel::FrameBuffer<kMaxFrameSize> mIoFrameBuffer;
+    RxRing                             mRxRing;
+    std::atomic<uint32_t>              mRxRingOverflowCount;
+    std::atomic<uint32_t>              mRxGarbageCount;
+    std::atomic<uint32_t>              mRxRingMaxUsedSize;
+#endif
+
     // Non-copyable, intentionally not implemented.
     HdlcInterface(const HdlcInterface &);
     HdlcInterface &operator=(const HdlcInterface &);
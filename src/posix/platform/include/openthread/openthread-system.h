@@ -242,6 +242,32 @@ const otRadioSpinelMetrics *otSysGetRadioSpinelMetrics(void);
  */
 const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void);
 
+/**
+ * Represents the packet counters of the Thread network interface (TUN device).
+ */
+typedef struct otSysNetifTunCounters
+{
+    uint32_t mReadWakeups;             ///< The number of mainloop iterations in which the TUN device was readable.
+    uint32_t mReadPackets;             ///< The number of packets read from the TUN device.
+    uint32_t mMaxReadPacketsPerWakeup; ///< The maximum number of packets read in one mainloop iteration.
+    uint32_t mWritePackets;            ///< The number of packets written to the TUN device.
+    uint32_t mWriteFailures;           ///< The number of packets which failed to be written to the TUN device.
+} otSysNetifTunCounters;
+
+/**
+ * Returns the packet counters of the Thread network interface.
+ *
+ * The average number of packets read per wakeup is `mReadPackets / mReadWakeups`.
+ *
+ * @returns The packet counters of the Thread network interface.
+ */
+const otSysNetifTunCounters *otSysGetNetifTunCounters(void);
+
+/**
+ * Resets the packet counters of the Thread network interface.
+ */
+void otSysResetNetifTunCounters(void);
+
 /**
  * Returns the ifr_flags of the infrastructure network interface.
  *
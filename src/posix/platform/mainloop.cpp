@@ -30,6 +30,14 @@
 
 #include <assert.h>
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+#ifndef __linux__
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE is only supported on Linux"
+#endif
+#include <errno.h>
+#include <poll.h>
+#endif
+
 #include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
@@ -72,6 +80,81 @@ exit:
     return;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+//---------------------------------------------------------------------------------------------------------------------
+// Source
+
+void Source::AddPollFdsTo(Context &aContext)
+{
+    for (uint8_t i = 0; i < mNumPollFds; i++)
+    {
+        PollFd &pollFd = mPollFds[i];
+
+        pollFd.revents = 0;
+
+        if (!pollFd.IsInUse())
+        {
+            continue;
+        }
+
+        if (pollFd.events & POLLIN)
+        {
+            AddToReadFdSet(pollFd.fd, aContext);
+        }
+
+        if (pollFd.events & POLLOUT)
+        {
+            AddToWriteFdSet(pollFd.fd, aContext);
+        }
+
+        if (pollFd.events & POLLPRI)
+        {
+            AddToErrorFdSet(pollFd.fd, aContext);
+        }
+    }
+}
+
+bool Source::UpdatePollEvents(const Context &aContext)
+{
+    // Sets the `revents` of the owned pollfds from the ready fd sets,
+    // so it does not matter whether the caller waited using
+    // `Manager::Poll()` or its own `select()`.
+
+    bool hasEvents = false;
+
+    for (uint8_t i = 0; i < mNumPollFds; i++)
+    {
+        PollFd &pollFd = mPollFds[i];
+
+        pollFd.revents = 0;
+
+        if (!pollFd.IsInUse())
+        {
+            continue;
+        }
+
+        if ((pollFd.events & POLLIN) && IsFdReadable(pollFd.fd, aContext))
+        {
+            pollFd.revents |= POLLIN;
+        }
+
+        if ((pollFd.events & POLLOUT) && IsFdWritable(pollFd.fd, aContext))
+        {
+            pollFd.revents |= POLLOUT;
+        }
+
+        if ((pollFd.events & POLLPRI) && HasFdErrored(pollFd.fd, aContext))
+        {
+            pollFd.revents |= POLLPRI;
+        }
+
+        hasEvents |= (pollFd.revents != 0);
+    }
+
+    return hasEvents;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // Manager
 
@@ -101,6 +184,13 @@ void Manager::Update(Context &aContext)
 {
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+        if (source->OwnsPollFds())
+        {
+            source->AddPollFdsTo(aContext);
+            continue;
+        }
+#endif
         source->Update(aContext);
     }
 }
@@ -109,10 +199,108 @@ void Manager::Process(const Context &aContext)
 {
     for (Source *source = mSources; source != nullptr; source = source->mNext)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+        if (source->OwnsPollFds() && !source->UpdatePollEvents(aContext))
+        {
+            continue;
+        }
+#endif
         source->Process(aContext);
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+int Manager::Poll(Context &aContext)
+{
+    static struct pollfd sPollFds[FD_SETSIZE];
+
+    nfds_t          numFds = 0;
+    struct timespec timeout;
+    int             rval;
+
+    // The fd sets hold all the registered file descriptors, including
+    // the pollfds owned by the sources (added by `Update()`).
+
+    for (int fd = 0; fd <= aContext.mMaxFd && fd < FD_SETSIZE; fd++)
+    {
+        short events = 0;
+
+        if (FD_ISSET(fd, &aContext.mReadFdSet))
+        {
+            events |= POLLIN;
+        }
+
+        if (FD_ISSET(fd, &aContext.mWriteFdSet))
+        {
+            events |= POLLOUT;
+        }
+
+        if (FD_ISSET(fd, &aContext.mErrorFdSet))
+        {
+            events |= POLLPRI;
+        }
+
+        if (events != 0)
+        {
+            sPollFds[numFds].fd      = fd;
+            sPollFds[numFds].events  = events;
+            sPollFds[numFds].revents = 0;
+            numFds++;
+        }
+    }
+
+    timeout.tv_sec  = aContext.mTimeout.tv_sec;
+    timeout.tv_nsec = static_cast<long>(aContext.mTimeout.tv_usec) * 1000;
+
+    rval = ppoll(sPollFds, numFds, &timeout, nullptr);
+    VerifyOrExit(rval >= 0);
+
+    FD_ZERO(&aContext.mReadFdSet);
+    FD_ZERO(&aContext.mWriteFdSet);
+    FD_ZERO(&aContext.mErrorFdSet);
+    rval = 0;
+
+    for (nfds_t i = 0; i < numFds; i++)
+    {
+        if (sPollFds[i].revents & POLLNVAL)
+        {
+            // `select()` fails the whole call for a closed descriptor.
+            errno = EBADF;
+            ExitNow(rval = -1);
+        }
+    }
+
+    for (nfds_t i = 0; i < numFds; i++)
+    {
+        PollFd pollFd;
+
+        pollFd.Set(sPollFds[i].fd, sPollFds[i].events);
+        pollFd.revents = sPollFds[i].revents;
+
+        if (pollFd.IsReadable())
+        {
+            FD_SET(pollFd.fd, &aContext.mReadFdSet);
+            rval++;
+        }
+
+        if (pollFd.IsWritable())
+        {
+            FD_SET(pollFd.fd, &aContext.mWriteFdSet);
+            rval++;
+        }
+
+        if (pollFd.HasErrored())
+        {
+            FD_SET(pollFd.fd, &aContext.mErrorFdSet);
+            rval++;
+        }
+    }
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
@@ -123,3 +311,178 @@ Manager &Manager::Get(void)
 } // namespace Mainloop
 } // namespace Posix
 } // namespace ot
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST && OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+
+#include <string.h>
+#include <unistd.h>
+
+using namespace ot::Posix::Mainloop;
+
+namespace {
+
+class OwnedSource : public Source
+{
+public:
+    explicit OwnedSource(int aFd)
+    {
+        mPollFd.Set(aFd, POLLIN);
+        SetPollFds(&mPollFd, 1);
+    }
+
+    void Update(Context &aContext) override
+    {
+        OT_UNUSED_VARIABLE(aContext);
+        mUpdateCount++;
+    }
+
+    void Process(const Context &aContext) override
+    {
+        OT_UNUSED_VARIABLE(aContext);
+        mProcessCount++;
+        mWasReadable = mPollFd.IsReadable();
+    }
+
+    PollFd   mPollFd;
+    uint32_t mUpdateCount  = 0;
+    uint32_t mProcessCount = 0;
+    bool     mWasReadable  = false;
+};
+
+class FdSetSource : public Source
+{
+public:
+    explicit FdSetSource(int aFd)
+        : mFd(aFd)
+    {
+    }
+
+    void Update(Context &aContext) override
+    {
+        AddToReadFdSet(mFd, aContext);
+        mUpdateCount++;
+    }
+
+    void Process(const Context &aContext) override
+    {
+        mProcessCount++;
+        mWasReadable = IsFdReadable(mFd, aContext);
+    }
+
+    int      mFd;
+    uint32_t mUpdateCount  = 0;
+    uint32_t mProcessCount = 0;
+    bool     mWasReadable  = false;
+};
+
+enum WaitMode
+{
+    kWaitWithPoll,
+    kWaitWithSelect,
+};
+
+int RunOnce(Manager &aManager, WaitMode aWaitMode = kWaitWithPoll)
+{
+    Context context;
+    int     rval;
+
+    memset(&context, 0, sizeof(context));
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd = -1;
+
+    aManager.Update(context);
+
+    if (aWaitMode == kWaitWithPoll)
+    {
+        rval = aManager.Poll(context);
+    }
+    else
+    {
+        // Like an embedder calling `otSysMainloopUpdate()`, then its
+        // own `select()`, then `otSysMainloopProcess()`.
+        rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                      &context.mTimeout);
+    }
+
+    assert(rval >= 0);
+    aManager.Process(context);
+
+    return rval;
+}
+
+} // namespace
+
+int main()
+{
+    Manager manager;
+    int     ownedPipe[2];
+    int     fdSetPipe[2];
+    char    byte = 0;
+
+    assert(pipe(ownedPipe) == 0);
+    assert(pipe(fdSetPipe) == 0);
+
+    {
+        OwnedSource owned(ownedPipe[0]);
+        FdSetSource fdSet(fdSetPipe[0]);
+
+        manager.Add(owned);
+        manager.Add(fdSet);
+
+        // Nothing is ready: only the fd set source is updated and processed.
+        assert(RunOnce(manager) == 0);
+        assert(owned.mUpdateCount == 0);
+        assert(owned.mProcessCount == 0);
+        assert(fdSet.mUpdateCount == 1);
+        assert(fdSet.mProcessCount == 1);
+        assert(!fdSet.mWasReadable);
+
+        // The owned pollfd is ready: the owned source is processed from its `revents`.
+        assert(write(ownedPipe[1], &byte, 1) == 1);
+        assert(RunOnce(manager) == 1);
+        assert(owned.mProcessCount == 1);
+        assert(owned.mWasReadable);
+        assert(!fdSet.mWasReadable);
+
+        // Both are ready.
+        assert(write(fdSetPipe[1], &byte, 1) == 1);
+        assert(RunOnce(manager) == 2);
+        assert(owned.mProcessCount == 2);
+        assert(owned.mWasReadable);
+        assert(fdSet.mWasReadable);
+
+        // Waiting with `select()` instead of `Manager::Poll()` still watches the owned pollfd.
+        assert(read(fdSetPipe[0], &byte, 1) == 1);
+        assert(RunOnce(manager, kWaitWithSelect) == 1);
+        assert(owned.mProcessCount == 3);
+        assert(owned.mWasReadable);
+        assert(!fdSet.mWasReadable);
+
+        // Drained, and the owned pollfd is stopped: the owned source is no longer polled.
+        assert(read(ownedPipe[0], &byte, 1) == 1);
+        assert(write(ownedPipe[1], &byte, 1) == 1);
+        owned.mPollFd.Clear();
+        assert(RunOnce(manager) == 0);
+        assert(RunOnce(manager, kWaitWithSelect) == 0);
+        assert(owned.mProcessCount == 3);
+        assert(owned.mUpdateCount == 0);
+        assert(fdSet.mProcessCount == 6);
+
+        manager.Remove(fdSet);
+        manager.Remove(owned);
+    }
+
+    close(ownedPipe[0]);
+    close(ownedPipe[1]);
+    close(fdSetPipe[0]);
+    close(fdSetPipe[1]);
+
+    return 0;
+}
+#endif
@@ -34,6 +34,12 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+#include <poll.h>
+#endif
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -131,6 +137,75 @@ uint64_t GetTimeout(const Context &aContext);
  */
 void SetTimeoutIfEarlier(uint64_t aTimeout, Context &aContext);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+/**
+ * Represents a file descriptor owned by a mainloop `Source` and registered in the mainloop by the `Manager`.
+ *
+ * The readiness checks follow the same rules as the fd set helpers above, so a source can switch from
+ * `IsFdReadable()` to `PollFd::IsReadable()` without changing behavior.
+ */
+class PollFd : public pollfd
+{
+public:
+    /**
+     * Initializes the `PollFd` as unused.
+     */
+    PollFd(void) { Clear(); }
+
+    /**
+     * Sets the file descriptor and the events to poll for.
+     *
+     * @param[in]  aFd      The file descriptor, or -1 to stop polling the entry.
+     * @param[in]  aEvents  The `poll()` events to wait for.
+     */
+    void Set(int aFd, short aEvents)
+    {
+        fd      = aFd;
+        events  = aEvents;
+        revents = 0;
+    }
+
+    /**
+     * Marks the `PollFd` as unused.
+     */
+    void Clear(void) { Set(-1, 0); }
+
+    /**
+     * Indicates whether the `PollFd` is in use.
+     *
+     * @retval TRUE   The entry has a file descriptor and events to poll for.
+     * @retval FALSE  The entry is unused.
+     */
+    bool IsInUse(void) const { return (fd >= 0) && (events != 0); }
+
+    /**
+     * Indicates whether the last poll reported the file descriptor as readable.
+     *
+     * @returns `true` if the file descriptor is readable, `false` otherwise.
+     */
+    bool IsReadable(void) const { return (events & POLLIN) && (revents & kReadEvents); }
+
+    /**
+     * Indicates whether the last poll reported the file descriptor as writable.
+     *
+     * @returns `true` if the file descriptor is writable, `false` otherwise.
+     */
+    bool IsWritable(void) const { return (events & POLLOUT) && (revents & kWriteEvents); }
+
+    /**
+     * Indicates whether the last poll reported an exceptional condition on the file descriptor.
+     *
+     * @returns `true` if the file descriptor has an error, `false` otherwise.
+     */
+    bool HasErrored(void) const { return (events & POLLPRI) && (revents & kErrorEvents); }
+
+    // Same event masks as the Linux `select()` implementation.
+    static constexpr short kReadEvents  = POLLIN | POLLHUP | POLLERR;
+    static constexpr short kWriteEvents = POLLOUT | POLLERR;
+    static constexpr short kErrorEvents = POLLPRI;
+};
+#endif
+
 /**
  * Is the base for all mainloop event sources.
  */
@@ -158,9 +233,38 @@ public:
      */
     virtual ~Source(void) = default;
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+protected:
+    /**
+     * Hands the `Manager` the pollfds owned by this source.
+     *
+     * Once set, `Update()` is no longer called on every pass. The `Manager` adds the entries to the fd sets of the
+     * context itself, so they are waited on whether the caller uses `Manager::Poll()` or its own `select()`, and calls
+     * `Process()` only when at least one of them is ready. Before `Process()`, the `revents` of the entries are set
+     * from the ready fd sets. The source updates the entries itself (using `PollFd::Set()`) whenever its file
+     * descriptors change.
+     *
+     * @param[in]  aPollFds     A pointer to an array of pollfds owned by the source.
+     * @param[in]  aNumPollFds  The number of entries in @p aPollFds.
+     */
+    void SetPollFds(PollFd *aPollFds, uint8_t aNumPollFds)
+    {
+        mPollFds    = aPollFds;
+        mNumPollFds = aNumPollFds;
+    }
+#endif
+
 private:
     static void AddFd(int aFd, Context &aContext, fd_set &aFdSet);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    bool OwnsPollFds(void) const { return mPollFds != nullptr; }
+    void AddPollFdsTo(Context &aContext);
+    bool UpdatePollEvents(const Context &aContext);
+
+    PollFd *mPollFds    = nullptr;
+    uint8_t mNumPollFds = 0;
+#endif
     Source *mNext = nullptr;
 };
 
@@ -184,6 +288,20 @@ public:
      */
     void Process(const Context &aContext);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+    /**
+     * Waits for the events in the mainloop context using `ppoll()`.
+     *
+     * This is a drop-in replacement for calling `select()` on the context. On return, the fd sets in @p aContext only
+     * contain the file descriptors which are ready, following the same readiness rules as `select()`.
+     *
+     * @param[in,out]  aContext  A reference to the mainloop context.
+     *
+     * @returns The total number of ready events, 0 on timeout, or -1 on failure with `errno` set.
+     */
+    int Poll(Context &aContext);
+#endif
+
     /**
      * Adds a new event source into the mainloop.
      *
@@ -174,10 +174,16 @@ extern int
 unsigned int gNetifIndex = 0;
 char         gNetifName[IFNAMSIZ];
 
+static otSysNetifTunCounters sTunCounters;
+
 const char *otSysGetThreadNetifName(void) { return gNetifName; }
 
 unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 
+const otSysNetifTunCounters *otSysGetNetifTunCounters(void) { return &sTunCounters; }
+
+void otSysResetNetifTunCounters(void) { memset(&sTunCounters, 0, sizeof(sTunCounters)); }
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
@@ -296,6 +302,10 @@ enum
 #endif
 
 static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+
+static constexpr uint32_t kTunBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE;
+
+static_assert(kTunBatchSize > 0, "OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE must be at least 1");
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -1252,11 +1262,14 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
 
+    sTunCounters.mWritePackets++;
+
 exit:
     otMessageFree(aMessage);
 
     if (error != OT_ERROR_NONE)
     {
+        sTunCounters.mWriteFailures++;
         LogWarn("Failed to receive, error:%s", otThreadErrorToString(error));
     }
 }
@@ -1366,13 +1379,19 @@ exit:
 }
 #endif // __linux__
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * Reads one packet from the TUN device and sends it through the stack.
+ *
+ * Returns false if no packet could be read, i.e., the TUN device has no more pending packets.
+ */
+static bool transmitPacket(otInstance *aInstance)
 {
     otMessage *message = nullptr;
     ssize_t    rval;
     char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
+    bool       didRead = false;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
@@ -1380,8 +1399,12 @@ static void processTransmit(otInstance *aInstance)
     assert(gInstance == aInstance);
 
     rval = read(sTunFd, packet, sizeof(packet));
+    VerifyOrExit((rval >= 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    didRead = true;
+    sTunCounters.mReadPackets++;
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
     if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
@@ -1445,6 +1468,25 @@ exit:
             LogWarn("Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    return didRead;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    uint32_t numPackets = 0;
+
+    while ((numPackets < kTunBatchSize) && transmitPacket(aInstance))
+    {
+        numPackets++;
+    }
+
+    sTunCounters.mReadWakeups++;
+
+    if (numPackets > sTunCounters.mMaxReadPacketsPerWakeup)
+    {
+        sTunCounters.mMaxReadPacketsPerWakeup = numPackets;
+    }
 }
 
 static void logAddrEvent(bool isAdd, const otIp6Address &aAddress, otError error)
@@ -42,6 +42,14 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 256
 #endif
 
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE 1
+#endif
+
+#ifndef OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS 32
+#endif
+
 #ifndef OPENTHREAD_CONFIG_DIAG_OUTPUT_BUFFER_SIZE
 #define OPENTHREAD_CONFIG_DIAG_OUTPUT_BUFFER_SIZE 500
 #endif
@@ -123,12 +131,20 @@
 #endif
 
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (256 * 1024)
+#else
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (63 * 1024)
 #endif
+#endif
 
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS (256 * 1024)
+#else
 #define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS (63 * 1024)
 #endif
+#endif
 
 #ifndef OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH
 #define OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH 640
@@ -164,6 +164,19 @@
 #define OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+ *
+ * The maximum number of IPv6 packets read from the Thread network interface (TUN device) and passed to the stack in
+ * one mainloop iteration. Reading stops earlier when the TUN device has no more pending packets.
+ *
+ * Larger values reduce the number of mainloop wakeups for bulk traffic (e.g., OTA images or NAT64), at the cost of
+ * processing more packets before other events are handled.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE 1
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
  *
@@ -484,6 +497,45 @@
 #define OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR_PERIOD (5000)
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+ *
+ * Define as 1 to wait for mainloop events using `ppoll()` instead of `select()` (Linux only).
+ *
+ * The kernel is then handed a compact list of the registered file descriptors rather than bitmaps spanning up to the
+ * highest descriptor, and the mainloop timeout keeps its microsecond precision. Mainloop sources may also own their
+ * pollfds, in which case they are no longer updated on every pass and are only processed when one of them is ready.
+ * Only the daemon socket source owns its pollfds so far.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_PPOLL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+ *
+ * Define as 1 to read and HDLC-decode the frames received from the RCP on a dedicated I/O thread.
+ *
+ * The decoded spinel frames are passed to the OpenThread thread through a lock-free single-producer/single-consumer
+ * ring, so that a long-running tasklet does not delay draining the RCP UART. Frames received while the ring is full
+ * are dropped and counted in `otRcpInterfaceMetrics`. Applicable only to the HDLC interface and not supported with
+ * virtual time.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_RING_SIZE
+ *
+ * The size (in bytes) of the ring passing received frames from the RCP I/O thread. MUST be a power of two.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_RING_SIZE
+#define OPENTHREAD_POSIX_CONFIG_RCP_IO_THREAD_RING_SIZE 32768
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Removed or renamed POSIX specific configs.
 
@@ -38,6 +38,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -85,7 +86,8 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
 {
     otError     error           = OT_ERROR_NONE;
     const char *directory       = GetSettingsPath();
-    off_t       lastValidOffset = 0;
+    size_t      lastValidOffset = 0;
+    off_t       fileSize;
 
     OT_ASSERT(strlen(directory) < kMaxFileBasePathNameSize);
     OT_ASSERT((aSettingsFileBaseName != nullptr) && strlen(aSettingsFileBaseName) < kMaxFileBaseNameSize);
@@ -109,41 +111,49 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
 
     VerifyOrDie(mSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(mSettingsFd, 0, SEEK_END), offset = lseek(mSettingsFd, 0, SEEK_SET); offset < size;)
+    // Load the whole file with a single bulk read, then validate the
+    // records from memory.
+
+    fileSize = lseek(mSettingsFd, 0, SEEK_END);
+    VerifyOrDie(fileSize >= 0, OT_EXIT_ERROR_ERRNO);
+
+    mSize = 0;
+    ReserveBuffer(static_cast<size_t>(fileSize));
+
+    while (mSize < static_cast<size_t>(fileSize))
     {
-        lastValidOffset = offset;
+        ssize_t rval = pread(mSettingsFd, mBuffer + mSize, static_cast<size_t>(fileSize) - mSize, mSize);
 
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        mSize += static_cast<size_t>(rval);
+    }
 
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    for (size_t offset = 0; offset < mSize;)
+    {
+        lastValidOffset = offset;
 
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+        VerifyOrExit(mSize - offset >= kRecordHeaderSize, error = OT_ERROR_PARSE);
+        VerifyOrExit(mSize - offset >= GetRecordSize(offset), error = OT_ERROR_PARSE);
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        offset += GetRecordSize(offset);
     }
 
 exit:
     if (error == OT_ERROR_PARSE)
     {
-        off_t fileSize = lseek(mSettingsFd, 0, SEEK_END);
-
         if (lastValidOffset > 0)
         {
-            otLogCritPlat("Settings file corrupt at offset %jd of %jd bytes, truncating to preserve %jd bytes of "
+            otLogCritPlat("Settings file corrupt at offset %zu of %jd bytes, truncating to preserve %zu bytes of "
                           "valid entries",
-                          (intmax_t)lastValidOffset, (intmax_t)fileSize, (intmax_t)lastValidOffset);
+                          lastValidOffset, (intmax_t)fileSize, lastValidOffset);
         }
         else
         {
             otLogCritPlat("Settings file corrupt from start (%jd bytes), truncating entire file", (intmax_t)fileSize);
         }
 
-        VerifyOrDie(ftruncate(mSettingsFd, lastValidOffset) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(ftruncate(mSettingsFd, static_cast<off_t>(lastValidOffset)) == 0, OT_EXIT_ERROR_ERRNO);
+        mSize = lastValidOffset;
     }
 
     return error;
@@ -155,62 +165,34 @@ void SettingsFile::Deinit(void)
     VerifyOrDie(close(mSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
     mSettingsFd = -1;
 
+    free(mBuffer);
+    mBuffer   = nullptr;
+    mSize     = 0;
+    mCapacity = 0;
+
 exit:
     return;
 }
 
 otError SettingsFile::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    off_t   size;
-    off_t   offset;
+    otError error = OT_ERROR_NONE;
+    size_t  offset;
 
     OT_ASSERT(mSettingsFd >= 0);
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    offset = lseek(mSettingsFd, 0, SEEK_SET);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(FindRecord(aKey, aIndex, offset), error = OT_ERROR_NOT_FOUND);
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        uint16_t length = ReadUint16(offset + sizeof(uint16_t));
 
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(mSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            memcpy(aValue, mBuffer + offset + kRecordHeaderSize, (length <= *aValueLength ? length : *aValueLength));
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = length;
     }
 
 exit:
@@ -219,140 +201,198 @@ exit:
 
 void SettingsFile::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int swapFd = -1;
+    OT_ASSERT(mSettingsFd >= 0);
+
+    if (RemoveRecords(aKey, -1) == 0)
+    {
+        // Nothing to replace, so the new record can simply be appended.
+        Add(aKey, aValue, aValueLength);
+    }
+    else
+    {
+        AppendRecord(aKey, aValue, aValueLength);
+        Rewrite();
+    }
+}
+
+void SettingsFile::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    size_t offset = mSize;
 
     OT_ASSERT(mSettingsFd >= 0);
 
-    switch (Delete(aKey, -1, &swapFd))
+    AppendRecord(aKey, aValue, aValueLength);
+
+    // A partially written record left behind by a power loss is dropped
+    // by `Init()`, so appending in place keeps the file consistent.
+    while (offset < mSize)
     {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
+        ssize_t rval = pwrite(mSettingsFd, mBuffer + offset, mSize - offset, static_cast<off_t>(offset));
 
-    default:
-        OT_ASSERT(false);
-        break;
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        offset += static_cast<size_t>(rval);
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    SwapPersist(swapFd);
+    VerifyOrDie(0 == fsync(mSettingsFd), OT_EXIT_ERROR_ERRNO);
 }
 
-void SettingsFile::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+otError SettingsFile::Delete(uint16_t aKey, int aIndex)
 {
-    off_t size;
-    int   swapFd;
+    otError error = OT_ERROR_NONE;
+    size_t  firstOffset;
 
     OT_ASSERT(mSettingsFd >= 0);
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    swapFd = SwapOpen();
+    VerifyOrExit(FindRecord(aKey, (aIndex >= 0) ? aIndex : 0, firstOffset), error = OT_ERROR_NOT_FOUND);
+    RemoveRecords(aKey, aIndex);
 
-    if (size > 0)
+    if (firstOffset == mSize)
     {
-        VerifyOrDie(0 == lseek(mSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        SwapWrite(swapFd, static_cast<uint16_t>(size));
+        // Only trailing records were removed, so the remaining content
+        // is already on disk and truncating the file is sufficient.
+        VerifyOrDie(0 == ftruncate(mSettingsFd, static_cast<off_t>(mSize)), OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(0 == fsync(mSettingsFd), OT_EXIT_ERROR_ERRNO);
+    }
+    else
+    {
+        Rewrite();
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    SwapPersist(swapFd);
+exit:
+    return error;
 }
 
-otError SettingsFile::Delete(uint16_t aKey, int aIndex) { return Delete(aKey, aIndex, nullptr); }
+void SettingsFile::Wipe(void)
+{
+    VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    mSize = 0;
+}
 
-otError SettingsFile::Delete(uint16_t aKey, int aIndex, int *aSwapFd)
+uint16_t SettingsFile::ReadUint16(size_t aOffset) const
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    off_t   size;
-    off_t   offset;
-    int     swapFd;
+    uint16_t value;
 
-    OT_ASSERT(mSettingsFd >= 0);
+    memcpy(&value, mBuffer + aOffset, sizeof(value));
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    offset = lseek(mSettingsFd, 0, SEEK_SET);
-    swapFd = SwapOpen();
+    return value;
+}
 
-    OT_ASSERT(swapFd != -1);
-    OT_ASSERT(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_FAILED);
+bool SettingsFile::FindRecord(uint16_t aKey, int aIndex, size_t &aOffset) const
+{
+    bool found = false;
 
-    while (offset < size)
+    for (aOffset = 0; aOffset < mSize; aOffset += GetRecordSize(aOffset))
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        if (ReadUint16(aOffset) != aKey)
+        {
+            continue;
+        }
 
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_FAILED);
+        if (aIndex == 0)
+        {
+            found = true;
+            break;
+        }
 
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_FAILED);
+        --aIndex;
+    }
+
+    return found;
+}
 
-        offset += sizeof(key) + sizeof(length) + length;
+size_t SettingsFile::RemoveRecords(uint16_t aKey, int aIndex)
+{
+    size_t numRemoved = 0;
+    size_t readOffset = 0;
+    size_t writeOffset;
 
-        if (aKey == key)
+    if (aIndex >= 0)
+    {
+        VerifyOrExit(FindRecord(aKey, aIndex, writeOffset));
+        readOffset = writeOffset + GetRecordSize(writeOffset);
+        numRemoved = 1;
+    }
+    else
+    {
+        // Compact the buffer in place, skipping over all records with `aKey`.
+        for (writeOffset = 0; readOffset < mSize;)
         {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_FAILED);
-                SwapWrite(swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
+            size_t recordSize = GetRecordSize(readOffset);
+
+            if (ReadUint16(readOffset) == aKey)
             {
-                VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_FAILED);
-                error = OT_ERROR_NONE;
-                continue;
+                numRemoved++;
             }
             else
             {
-                --aIndex;
+                memmove(mBuffer + writeOffset, mBuffer + readOffset, recordSize);
+                writeOffset += recordSize;
             }
+
+            readOffset += recordSize;
         }
+    }
 
-        rval = write(swapFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_FAILED);
+    memmove(mBuffer + writeOffset, mBuffer + readOffset, mSize - readOffset);
+    mSize -= readOffset - writeOffset;
 
-        rval = write(swapFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_FAILED);
+exit:
+    return numRemoved;
+}
 
-        SwapWrite(swapFd, length);
-    }
+void SettingsFile::AppendRecord(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    ReserveBuffer(mSize + kRecordHeaderSize + aValueLength);
 
-exit:
-    if (aSwapFd != nullptr)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
+    memcpy(mBuffer + mSize, &aKey, sizeof(aKey));
+    memcpy(mBuffer + mSize + sizeof(aKey), &aValueLength, sizeof(aValueLength));
+
+    if (aValueLength > 0)
     {
-        SwapPersist(swapFd);
+        memcpy(mBuffer + mSize + kRecordHeaderSize, aValue, aValueLength);
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+
+    mSize += kRecordHeaderSize + aValueLength;
+}
+
+void SettingsFile::ReserveBuffer(size_t aCapacity)
+{
+    size_t   capacity = (mCapacity > 0) ? mCapacity : kMinBufferCapacity;
+    uint8_t *buffer;
+
+    VerifyOrExit(mBuffer == nullptr || aCapacity > mCapacity);
+
+    while (capacity < aCapacity)
     {
-        SwapDiscard(swapFd);
+        capacity *= 2;
     }
-    else if (error == OT_ERROR_FAILED)
+
+    buffer = static_cast<uint8_t *>(realloc(mBuffer, capacity));
+    VerifyOrDie(buffer != nullptr, OT_EXIT_FAILURE);
+
+    mBuffer   = buffer;
+    mCapacity = capacity;
+
+exit:
+    return;
+}
+
+void SettingsFile::Rewrite(void)
+{
+    int    swapFd = SwapOpen();
+    size_t offset = 0;
+
+    while (offset < mSize)
     {
-        SwapDiscard(swapFd);
-        DieNow(error);
+        ssize_t rval = write(swapFd, mBuffer + offset, mSize - offset);
+
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        offset += static_cast<size_t>(rval);
     }
 
-    return error;
+    SwapPersist(swapFd);
 }
 
-void SettingsFile::Wipe(void) { VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO); }
-
 void SettingsFile::GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap)
 {
     int length;
@@ -374,25 +414,6 @@ int SettingsFile::SwapOpen(void)
     return fd;
 }
 
-void SettingsFile::SwapWrite(int aFd, uint16_t aLength)
-{
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
-
-    while (aLength > 0)
-    {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(mSettingsFd, buffer, count);
-
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        OT_ASSERT(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
-    }
-}
-
 void SettingsFile::SwapPersist(int aFd)
 {
     char swapFile[kMaxFilePathSize];
@@ -422,14 +443,5 @@ void SettingsFile::SwapPersist(int aFd)
     mSettingsFd = aFd;
 }
 
-void SettingsFile::SwapDiscard(int aFd)
-{
-    char swapFileName[kMaxFilePathSize];
-
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    GetSettingsFilePath(swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
-}
-
 } // namespace Posix
 } // namespace ot
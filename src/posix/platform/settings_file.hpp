@@ -72,6 +72,9 @@ public:
 
     SettingsFile(void)
         : mSettingsFd(-1)
+        , mBuffer(nullptr)
+        , mSize(0)
+        , mCapacity(0)
     {
     }
 
@@ -145,17 +148,30 @@ private:
     static constexpr size_t kMaxFileBasePathNameSize = kMaxFileFullPathNameSize - kSlashLength - kMaxFileBaseNameSize;
     static constexpr size_t kMaxFilePathSize         = PATH_MAX;
 
-    otError Delete(uint16_t aKey, int aIndex, int *aSwapFd);
-    void    GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
-    int     SwapOpen(void);
-    void    SwapWrite(int aFd, uint16_t aLength);
-    void    SwapPersist(int aFd);
-    void    SwapDiscard(int aFd);
+    static constexpr size_t kRecordHeaderSize = sizeof(uint16_t) + sizeof(uint16_t); ///< Key and length fields.
+    static constexpr size_t kMinBufferCapacity = 1024;
+
+    uint16_t ReadUint16(size_t aOffset) const;
+    size_t   GetRecordSize(size_t aOffset) const { return kRecordHeaderSize + ReadUint16(aOffset + sizeof(uint16_t)); }
+    bool     FindRecord(uint16_t aKey, int aIndex, size_t &aOffset) const;
+    size_t   RemoveRecords(uint16_t aKey, int aIndex);
+    void     AppendRecord(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+    void     ReserveBuffer(size_t aCapacity);
+    void     Rewrite(void);
+    void     GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
+    int      SwapOpen(void);
+    void     SwapPersist(int aFd);
 
     static char sSettingsPath[kMaxFileBasePathNameSize];
     static char sSettingsFileName[kMaxFileBaseNameSize];
     char        mSettingsFileFullPathName[kMaxFileFullPathNameSize];
     int         mSettingsFd;
+
+    // In-memory image of the settings file. All reads are served from
+    // `mBuffer` and every change is mirrored to it before reaching disk.
+    uint8_t *mBuffer;
+    size_t   mSize;
+    size_t   mCapacity;
 };
 
 } // namespace Posix
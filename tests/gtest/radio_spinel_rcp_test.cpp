@@ -519,4 +519,42 @@ TEST(RadioSpinelSrcMatch, shouldNotDuplicateSrcMatchEntriesOnRestoreProperties)
     ASSERT_EQ(platform.SrcMatchHasShortEntry(kTestShortAddr), 1);
     ASSERT_EQ(platform.SrcMatchHasExtEntry(kTestExtAddrReversed), 1);
 }
+
+TEST(RadioSpinelSrcMatch, shouldRestoreAllSrcMatchEntriesOnRestoreProperties)
+{
+    // Use more entries than spinel transaction ids, so that the pipelined restore requests wrap around.
+    constexpr uint8_t kNumEntries =
+        (OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES < 20) ? OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES : 20;
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+
+    for (uint8_t i = 0; i < kNumEntries; i++)
+    {
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchShortEntry(0x1000 + i), kErrorNone);
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchExtEntry(otExtAddress{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, i}),
+                  kErrorNone);
+    }
+
+    // Simulate RCP reset, which drops the tables on the RCP.
+    platform.SrcMatchClearShortEntries();
+    platform.SrcMatchClearExtEntries();
+
+    platform.mRadioSpinel.RestoreProperties();
+
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), kNumEntries);
+    ASSERT_EQ(platform.SrcMatchCountExtEntries(), kNumEntries);
+
+    for (uint8_t i = 0; i < kNumEntries; i++)
+    {
+        ASSERT_EQ(platform.SrcMatchHasShortEntry(0x1000 + i), 1);
+        // The extended address is stored in little-endian byte order.
+        ASSERT_EQ(platform.SrcMatchHasExtEntry(otExtAddress{i, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11}), 1);
+    }
+
+    // Synchronous requests still work after the pipelined restore.
+    ASSERT_EQ(platform.mRadioSpinel.ClearSrcMatchShortEntry(0x1000), kErrorNone);
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), kNumEntries - 1);
+}
+
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
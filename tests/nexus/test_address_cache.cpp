@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kNumEids = 400;
+
+static Ip6::Address EidFor(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    SuccessOrQuit(eid.FromString("fd00:1234::"));
+    eid.mFields.m16[7] = BigEndian::HostSwap16(aIndex + 1);
+
+    return eid;
+}
+
+static uint16_t CollectCacheEntries(Node &aNode, bool aPresent[kNumEids])
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+    uint16_t                   count = 0;
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        aPresent[i] = false;
+    }
+
+    iterator.Clear();
+
+    while (aNode.Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        uint16_t index = BigEndian::HostSwap16(AsCoreType(&info.mTarget).mFields.m16[7]) - 1;
+
+        VerifyOrQuit(index < kNumEids);
+        VerifyOrQuit(!aPresent[index]);
+        aPresent[index] = true;
+        count++;
+    }
+
+    return count;
+}
+
+static void ValidateLookUps(Node &aNode, uint16_t aRloc16, const bool aPresent[kNumEids])
+{
+    uint32_t hits   = 0;
+    uint32_t misses = 0;
+
+    aNode.Get<AddressResolver>().ResetAddressCacheCounters();
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        uint16_t rloc16 = aNode.Get<AddressResolver>().LookUp(EidFor(i));
+
+        if (aPresent[i])
+        {
+            VerifyOrQuit(rloc16 == aRloc16);
+            hits++;
+        }
+        else
+        {
+            VerifyOrQuit(rloc16 == Mle::kInvalidRloc16);
+            misses++;
+        }
+    }
+
+    VerifyOrQuit(aNode.Get<AddressResolver>().GetAddressCacheCounters().mHits == hits);
+    VerifyOrQuit(aNode.Get<AddressResolver>().GetAddressCacheCounters().mMisses == misses);
+}
+
+void TestAddressCache(void)
+{
+    /**
+     * Test the EID-to-RLOC address cache lookups, eviction and removal.
+     *
+     * Topology:
+     *   ROUTER_2 ----- ROUTER_1 ---- ROUTER_3
+     *
+     * ROUTER_1 is leader. ROUTER_2 adds snooped cache entries for more EIDs than the cache can hold, all mapping
+     * to ROUTER_3. The cache content (as reported by the iterator) is checked against lookups.
+     */
+
+    Core     nexus;
+    bool     present[kNumEids];
+    uint16_t numEntries;
+    uint16_t numRemoved;
+
+    Node &router1 = nexus.CreateNode();
+    Node &router2 = nexus.CreateNode();
+    Node &router3 = nexus.CreateNode();
+
+    router1.SetName("Router_1");
+    router2.SetName("Router_2");
+    router3.SetName("Router_3");
+
+    AllowLinkBetween(router1, router2);
+    AllowLinkBetween(router1, router3);
+
+    nexus.AdvanceTime(0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 1: Form network");
+
+    router1.Form();
+    nexus.AdvanceTime(13 * 1000);
+    VerifyOrQuit(router1.Get<Mle::Mle>().IsLeader());
+
+    router2.Join(router1);
+    nexus.AdvanceTime(200 * 1000);
+    VerifyOrQuit(router2.Get<Mle::Mle>().IsRouter());
+
+    router3.Join(router1);
+    nexus.AdvanceTime(200 * 1000);
+    VerifyOrQuit(router3.Get<Mle::Mle>().IsRouter());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 2: Add snooped entries for more EIDs than the cache size");
+
+    router2.Get<AddressResolver>().Clear();
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        router2.Get<AddressResolver>().UpdateSnoopedCacheEntry(EidFor(i), router3.Get<Mle::Mle>().GetRloc16(),
+                                                               router2.Get<Mle::Mle>().GetRloc16());
+    }
+
+    numEntries = CollectCacheEntries(router2, present);
+    Log("Number of cache entries: %u", numEntries);
+    VerifyOrQuit(numEntries == OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES);
+
+    // The most recently snooped EID must have evicted an older one.
+    VerifyOrQuit(present[kNumEids - 1]);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 3: Look up all EIDs and validate against the cache content");
+
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+
+    // Lookups must not change which EIDs are in the cache.
+    VerifyOrQuit(CollectCacheEntries(router2, present) == numEntries);
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 4: Remove every third cached EID");
+
+    numRemoved = 0;
+
+    for (uint16_t i = 0; i < kNumEids; i += 3)
+    {
+        if (present[i])
+        {
+            router2.Get<AddressResolver>().RemoveEntryForAddress(EidFor(i));
+            numRemoved++;
+        }
+    }
+
+    VerifyOrQuit(CollectCacheEntries(router2, present) == numEntries - numRemoved);
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 5: Add the EIDs again, evicting the least recently used entries");
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        router2.Get<AddressResolver>().UpdateSnoopedCacheEntry(EidFor(i), router3.Get<Mle::Mle>().GetRloc16(),
+                                                               router2.Get<Mle::Mle>().GetRloc16());
+    }
+
+    VerifyOrQuit(CollectCacheEntries(router2, present) == numEntries);
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 6: Remove entries for ROUTER_3 RLOC16 and clear the cache");
+
+    router2.Get<AddressResolver>().RemoveEntriesForRloc16(router3.Get<Mle::Mle>().GetRloc16());
+    VerifyOrQuit(CollectCacheEntries(router2, present) == 0);
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        router2.Get<AddressResolver>().UpdateSnoopedCacheEntry(EidFor(i), router3.Get<Mle::Mle>().GetRloc16(),
+                                                               router2.Get<Mle::Mle>().GetRloc16());
+    }
+
+    router2.Get<AddressResolver>().Clear();
+    VerifyOrQuit(CollectCacheEntries(router2, present) == 0);
+    ValidateLookUps(router2, router3.Get<Mle::Mle>().GetRloc16(), present);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestAddressCache();
+    printf("All tests passed\n");
+    return 0;
+}
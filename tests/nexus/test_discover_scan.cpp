@@ -156,12 +156,99 @@ void TestDiscoverScanRequestCallback(void)
     VerifyOrQuit(result->IsDiscover());
 }
 
+void TestDiscoverScanMultipleChannels(void)
+{
+    static constexpr uint8_t kNumOtherChannels = 2;
+
+    Core             nexus;
+    Node            &leader  = nexus.CreateNode();
+    Node            &scanner = nexus.CreateNode();
+    DiscoverContext  resultContext;
+    Mac::ChannelMask scanMask;
+    uint8_t          leaderChannel;
+    uint8_t          channel;
+    uint8_t          numOtherChannels;
+    ScanResult      *result;
+
+    Log("------------------------------------------------------------------------------------------------------");
+    Log("TestDiscoverScanMultipleChannels");
+
+    nexus.AdvanceTime(0);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Form the network");
+
+    leader.Form();
+    nexus.AdvanceTime(50 * Time::kOneSecondInMsec);
+
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    scanner.Get<ThreadNetif>().Up();
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Prepare a scan channel mask with the leader channel and %u other channels", kNumOtherChannels);
+
+    leaderChannel    = leader.Get<Mac::Mac>().GetPanChannel();
+    channel          = Mac::ChannelMask::kChannelIteratorFirst;
+    numOtherChannels = 0;
+
+    scanMask.AddChannel(leaderChannel);
+
+    while ((numOtherChannels < kNumOtherChannels) &&
+           (scanner.Get<Mac::Mac>().GetSupportedChannelMask().GetNextChannel(channel) == kErrorNone))
+    {
+        if (channel != leaderChannel)
+        {
+            scanMask.AddChannel(channel);
+            numOtherChannels++;
+        }
+    }
+
+    VerifyOrQuit(scanMask.GetNumberOfChannels() == kNumOtherChannels + 1);
+    Log("   Scan mask: %s", scanMask.ToString().AsCString());
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Perform discover scan from `scanner` over all channels in the mask");
+
+    resultContext.Clear();
+
+    SuccessOrQuit(scanner.Get<Mle::DiscoverScanner>().Discover(scanMask, 0xffff, /* aJoiner */ false,
+                                                               /* aFilter */ false, /* aFilterIndexes */ nullptr,
+                                                               HandleDiscoverResult, &resultContext));
+
+    nexus.AdvanceTime(10 * Time::kOneSecondInMsec);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Check the scan completed on all channels and found the leader");
+
+    VerifyOrQuit(resultContext.mDiscoverDone);
+    VerifyOrQuit(!scanner.Get<Mle::DiscoverScanner>().IsInProgress());
+    VerifyOrQuit(resultContext.mScanResults.GetLength() == 1);
+
+    result = &resultContext.mScanResults[0];
+
+    VerifyOrQuit(result->GetExtAddress() == leader.Get<Mac::Mac>().GetExtAddress());
+    VerifyOrQuit(result->GetChannel() == leaderChannel);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Check the Discovery Request message is no longer in the send queue");
+
+    {
+        PriorityQueue::Info sendQueueInfo;
+        MessageQueue::Info  reassemblyQueueInfo;
+
+        scanner.Get<MeshForwarder>().GetQueueInfo(sendQueueInfo, reassemblyQueueInfo);
+        VerifyOrQuit(sendQueueInfo.mNumMessages == 0);
+    }
+}
+
 } // namespace Nexus
 } // namespace ot
 
 int main(void)
 {
     ot::Nexus::TestDiscoverScanRequestCallback();
+    ot::Nexus::TestDiscoverScanMultipleChannels();
     printf("All tests passed\n");
     return 0;
 }
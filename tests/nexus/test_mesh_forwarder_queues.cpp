@@ -0,0 +1,288 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "thread/child_table.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kUdpPort       = 12345;
+static constexpr uint16_t kMaxReceived   = 16;
+static constexpr uint32_t kSedPollPeriod = 20 * 1000;
+
+class UdpReceiver
+{
+public:
+    explicit UdpReceiver(Node &aNode)
+        : mSocket(aNode, HandleUdpReceive, this)
+        , mNumReceived(0)
+    {
+        SuccessOrQuit(mSocket.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(mSocket.Bind(kUdpPort));
+    }
+
+    ~UdpReceiver(void) { IgnoreError(mSocket.Close()); }
+
+    void     Clear(void) { mNumReceived = 0; }
+    uint16_t GetNumReceived(void) const { return mNumReceived; }
+    uint8_t  GetId(uint16_t aIndex) const { return mIds[aIndex]; }
+    Ip6::Ecn GetEcn(uint16_t aIndex) const { return mEcns[aIndex]; }
+
+private:
+    static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+    {
+        static_cast<UdpReceiver *>(aContext)->HandleUdpReceive(AsCoreType(aMessage), AsCoreType(aMessageInfo));
+    }
+
+    void HandleUdpReceive(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        uint8_t id;
+
+        SuccessOrQuit(aMessage.Read(aMessage.GetOffset(), id));
+        VerifyOrQuit(mNumReceived < kMaxReceived);
+
+        mIds[mNumReceived]  = id;
+        mEcns[mNumReceived] = aMessageInfo.GetEcn();
+        mNumReceived++;
+    }
+
+    Ip6::Udp::Socket mSocket;
+    uint16_t         mNumReceived;
+    uint8_t          mIds[kMaxReceived];
+    Ip6::Ecn         mEcns[kMaxReceived];
+};
+
+static void SendUdp(Node              &aSender,
+                    Node              &aReceiver,
+                    uint8_t            aId,
+                    Message::Priority  aPriority = Message::kPriorityNormal,
+                    Ip6::Ecn           aEcn      = Ip6::kEcnNotCapable)
+{
+    Ip6::Udp::Socket socket(aSender, nullptr, nullptr);
+    Ip6::MessageInfo messageInfo;
+    Message         *message;
+
+    SuccessOrQuit(socket.Open(Ip6::kNetifThreadInternal));
+
+    message = socket.NewMessage(Message::Settings(aPriority));
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Append(aId));
+
+    messageInfo.SetPeerAddr(aReceiver.Get<Mle::Mle>().GetMeshLocalEid());
+    messageInfo.SetPeerPort(kUdpPort);
+    messageInfo.SetEcn(aEcn);
+
+    SuccessOrQuit(socket.SendTo(*message, messageInfo));
+    SuccessOrQuit(socket.Close());
+}
+
+static uint16_t GetNumQueuedMessages(Node &aNode)
+{
+    PriorityQueue::Info sendQueueInfo;
+    MessageQueue::Info  reassemblyQueueInfo;
+
+    aNode.Get<MeshForwarder>().GetQueueInfo(sendQueueInfo, reassemblyQueueInfo);
+
+    return sendQueueInfo.mNumMessages;
+}
+
+static void HandleEnergyScanResult(otEnergyScanResult *aResult, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aResult);
+    OT_UNUSED_VARIABLE(aContext);
+}
+
+void TestMeshForwarderQueues(void)
+{
+    Core nexus;
+
+    Node &leader = nexus.CreateNode();
+    Node &med1   = nexus.CreateNode();
+    Node &med2   = nexus.CreateNode();
+    Node &sed1   = nexus.CreateNode();
+    Node &sed2   = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    med1.SetName("MED_1");
+    med2.SetName("MED_2");
+    sed1.SetName("SED_1");
+    sed2.SetName("SED_2");
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelInfo));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(15 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    med1.Join(leader, Node::kAsMed);
+    med2.Join(leader, Node::kAsMed);
+    sed1.Join(leader, Node::kAsSed);
+    sed2.Join(leader, Node::kAsSed);
+    nexus.AdvanceTime(10 * 1000);
+
+    VerifyOrQuit(med1.Get<Mle::Mle>().IsChild());
+    VerifyOrQuit(med2.Get<Mle::Mle>().IsChild());
+    VerifyOrQuit(sed1.Get<Mle::Mle>().IsChild());
+    VerifyOrQuit(sed2.Get<Mle::Mle>().IsChild());
+
+    SuccessOrQuit(sed1.Get<DataPollSender>().SetExternalPollPeriod(kSedPollPeriod));
+    SuccessOrQuit(sed2.Get<DataPollSender>().SetExternalPollPeriod(kSedPollPeriod));
+    nexus.AdvanceTime(kSedPollPeriod);
+
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 0);
+
+    UdpReceiver med1Receiver(med1);
+    UdpReceiver med2Receiver(med2);
+    UdpReceiver sed1Receiver(sed1);
+    UdpReceiver sed2Receiver(sed2);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Queue indirect messages with different priorities for SED_1");
+
+    SendUdp(leader, sed1, 1, Message::kPriorityLow);
+    SendUdp(leader, sed1, 2, Message::kPriorityNormal);
+    SendUdp(leader, sed1, 3, Message::kPriorityHigh);
+    SendUdp(leader, sed1, 4, Message::kPriorityNormal);
+    nexus.AdvanceTime(10);
+
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 4);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send direct message to MED_1 while indirect messages are queued");
+
+    SendUdp(leader, med1, 10);
+    nexus.AdvanceTime(100);
+
+    VerifyOrQuit(med1Receiver.GetNumReceived() == 1);
+    VerifyOrQuit(med1Receiver.GetId(0) == 10);
+    VerifyOrQuit(sed1Receiver.GetNumReceived() == 0);
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 4);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Check SED_1 receives the queued messages in priority order");
+
+    nexus.AdvanceTime(kSedPollPeriod + 1000);
+
+    VerifyOrQuit(sed1Receiver.GetNumReceived() == 4);
+    VerifyOrQuit(sed1Receiver.GetId(0) == 3);
+    VerifyOrQuit(sed1Receiver.GetId(1) == 2);
+    VerifyOrQuit(sed1Receiver.GetId(2) == 4);
+    VerifyOrQuit(sed1Receiver.GetId(3) == 1);
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Queue messages for SED_2 and change its mode to rx-on-when-idle");
+
+    SendUdp(leader, sed2, 20);
+    SendUdp(leader, sed2, 21);
+    nexus.AdvanceTime(10);
+
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 2);
+
+    SuccessOrQuit(sed2.Get<Mle::Mle>().SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle)));
+    nexus.AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sed2Receiver.GetNumReceived() == 2);
+    VerifyOrQuit(sed2Receiver.GetId(0) == 20);
+    VerifyOrQuit(sed2Receiver.GetId(1) == 21);
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Check ECN marking of forwarded messages delayed in the queue");
+
+    // An energy scan on the leader's channel delays the direct tx of
+    // messages forwarded from MED_1 to MED_2 while still allowing the
+    // leader to receive them. The first message is already prepared
+    // for tx when the scan ends, so the queue management rules apply
+    // to the messages after it.
+
+    SuccessOrQuit(leader.Get<Mac::Mac>().EnergyScan(1u << leader.Get<Mac::Mac>().GetPanChannel(), 1000,
+                                                    HandleEnergyScanResult, nullptr));
+    nexus.AdvanceTime(10);
+
+    SendUdp(med1, med2, 30, Message::kPriorityNormal, Ip6::kEcnCapable0);
+    SendUdp(med1, med2, 31, Message::kPriorityNormal, Ip6::kEcnCapable0);
+    SendUdp(med1, med2, 32, Message::kPriorityNormal, Ip6::kEcnNotCapable);
+    nexus.AdvanceTime(3 * 1000);
+
+    VerifyOrQuit(med2Receiver.GetNumReceived() == 2);
+    VerifyOrQuit(med2Receiver.GetId(0) == 30);
+    VerifyOrQuit(med2Receiver.GetEcn(0) == Ip6::kEcnCapable0);
+    VerifyOrQuit(med2Receiver.GetId(1) == 31);
+    VerifyOrQuit(med2Receiver.GetEcn(1) == Ip6::kEcnMarked);
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Check forwarded messages are dropped after a longer delay in the queue");
+
+    med2Receiver.Clear();
+
+    SuccessOrQuit(leader.Get<Mac::Mac>().EnergyScan(1u << leader.Get<Mac::Mac>().GetPanChannel(), 2000,
+                                                    HandleEnergyScanResult, nullptr));
+    nexus.AdvanceTime(10);
+
+    SendUdp(med1, med2, 40, Message::kPriorityNormal, Ip6::kEcnCapable0);
+    SendUdp(med1, med2, 41, Message::kPriorityNormal, Ip6::kEcnCapable0);
+    nexus.AdvanceTime(4 * 1000);
+
+    VerifyOrQuit(med2Receiver.GetNumReceived() == 1);
+    VerifyOrQuit(med2Receiver.GetId(0) == 40);
+    VerifyOrQuit(GetNumQueuedMessages(leader) == 0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Check direct messages are delivered after the delay");
+
+    med2Receiver.Clear();
+
+    SendUdp(med1, med2, 50, Message::kPriorityNormal, Ip6::kEcnCapable0);
+    nexus.AdvanceTime(1000);
+
+    VerifyOrQuit(med2Receiver.GetNumReceived() == 1);
+    VerifyOrQuit(med2Receiver.GetId(0) == 50);
+    VerifyOrQuit(med2Receiver.GetEcn(0) == Ip6::kEcnCapable0);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestMeshForwarderQueues();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -51,8 +51,14 @@
 
 #define OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE 1
 
+#define OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE 1
+
 #define OPENTHREAD_CONFIG_COAP_API_ENABLE 1
 
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE 1
+
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_BYTES 2048
+
 #define OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE 1
 
 #define OPENTHREAD_CONFIG_DNS_CLIENT_BIND_UDP_TO_THREAD_NETIF 1
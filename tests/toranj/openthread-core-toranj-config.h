@@ -101,6 +101,8 @@
 
 #define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE 1
 
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE 1
+
 #define OPENTHREAD_CONFIG_TMF_ANYCAST_LOCATOR_ENABLE 1
 
 #define OPENTHREAD_CONFIG_ECDSA_ENABLE 1
@@ -29,6 +29,8 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/random.hpp"
+#include "crypto/aes_accel.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -448,6 +450,177 @@ void TestPlatformCcmSinglePart(void)
 
 #endif // OPENTHREAD_CONFIG_CRYPTO_PLATFORM_CCM_ONE_SHOT_ENABLE
 
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+/**
+ * Measures AES-CCM encryption and decryption of IEEE 802.15.4 frames (23-byte MAC header including the auxiliary
+ * security header) for a range of payload sizes and MIC lengths.
+ */
+void TestAesCcmPerformance(const char *aEngineName)
+{
+    static constexpr uint16_t kHeaderLength = 23;
+    static constexpr uint16_t kMaxFrameSize = 127;
+    static constexpr uint16_t kIterations   = 20000;
+
+    static const uint8_t  kTagLengths[]     = {4, 8, 16};
+    static const uint16_t kPayloadLengths[] = {10, 32, 64, 100};
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+    };
+
+    otInstance *instance = testInitInstance();
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("\nTestAesCcmPerformance (%s)\n", aEngineName);
+
+    for (uint8_t tagLength : kTagLengths)
+    {
+        for (uint16_t payloadLength : kPayloadLengths)
+        {
+            uint8_t        frame[kMaxFrameSize];
+            uint16_t       frameLength = kHeaderLength + payloadLength + tagLength;
+            Crypto::AesCcm aesCcm;
+            uint64_t       startTime;
+            uint64_t       duration;
+
+            if (frameLength > kMaxFrameSize)
+            {
+                continue;
+            }
+
+            Random::NonCrypto::FillBuffer(frame, kHeaderLength + payloadLength);
+
+            aesCcm.SetKey(kKey, sizeof(kKey));
+            aesCcm.SetNonce(kNonce, sizeof(kNonce));
+            aesCcm.SetAuthData(frame, kHeaderLength);
+            aesCcm.SetTagLength(tagLength);
+
+            startTime = GetWallClockUsec();
+
+            for (uint16_t iter = 0; iter < kIterations; iter++)
+            {
+                SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, &frame[kHeaderLength], payloadLength));
+                SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kDecrypt, &frame[kHeaderLength], payloadLength));
+            }
+
+            duration = GetWallClockUsec() - startTime;
+
+            printf("frame:%4u payload:%4u mic:%2u -> %.3f usec/frame", frameLength, payloadLength, tagLength,
+                   static_cast<double>(duration) / (2 * kIterations));
+
+            if (duration > 0)
+            {
+                printf(", %.1f MB/s", static_cast<double>(frameLength) * 2 * kIterations / duration);
+            }
+
+            printf("\n");
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+
+class UnitTester
+{
+public:
+    static void SetAesAccelSupported(bool aSupported)
+    {
+        Crypto::AesAccel::sSupportState =
+            aSupported ? Crypto::AesAccel::kSupportUnknown : Crypto::AesAccel::kNotSupported;
+    }
+
+    static void TestAesCcmAccel(void)
+    {
+        // Verifies that the accelerated AES-CCM engine produces the
+        // same output as the `otPlatCryptoAes` based one.
+
+        static constexpr uint16_t kMaxAuthDataLength = 40;
+        static constexpr uint16_t kMaxPayloadLength  = 200;
+        static constexpr uint16_t kNumIters          = 2000;
+
+        static const uint8_t kTagLengths[] = {4, 6, 8, 10, 12, 14, 16};
+
+        otInstance *instance = testInitInstance();
+        uint8_t     key[Crypto::AesAccel::kKeySize];
+        uint8_t     nonce[Crypto::AesCcm::kMaxNonceLength];
+        uint8_t     authData[kMaxAuthDataLength];
+        uint8_t     plainText[kMaxPayloadLength + Crypto::AesCcm::kMaxTagLength];
+        uint8_t     accelFrame[kMaxPayloadLength + Crypto::AesCcm::kMaxTagLength];
+        uint8_t     frame[kMaxPayloadLength + Crypto::AesCcm::kMaxTagLength];
+
+        VerifyOrQuit(instance != nullptr);
+
+        printf("\nTestAesCcmAccel: CPU AES instructions %ssupported\n",
+               Crypto::AesAccel::IsSupported() ? "" : "not ");
+
+        for (uint16_t iter = 0; iter < kNumIters; iter++)
+        {
+            Crypto::AesCcm aesCcm;
+            uint8_t        nonceLength;
+            uint8_t        tagLength;
+            uint16_t       authDataLength;
+            uint16_t       payloadLength;
+
+            nonceLength    = Random::NonCrypto::GenerateInClosedRange<uint8_t>(Crypto::AesCcm::kMinNonceLength,
+                                                                               Crypto::AesCcm::kMaxNonceLength);
+            tagLength      = kTagLengths[Random::NonCrypto::GenerateUpToExcluding<uint8_t>(sizeof(kTagLengths))];
+            authDataLength = Random::NonCrypto::GenerateInClosedRange<uint16_t>(0, kMaxAuthDataLength);
+            payloadLength  = Random::NonCrypto::GenerateInClosedRange<uint16_t>(0, kMaxPayloadLength);
+
+            Random::NonCrypto::FillBuffer(key, sizeof(key));
+            Random::NonCrypto::FillBuffer(nonce, sizeof(nonce));
+            Random::NonCrypto::FillBuffer(authData, sizeof(authData));
+            Random::NonCrypto::FillBuffer(plainText, sizeof(plainText));
+
+            aesCcm.SetKey(key, sizeof(key));
+            aesCcm.SetNonce(nonce, nonceLength);
+            aesCcm.SetAuthData(authData, authDataLength);
+            aesCcm.SetTagLength(tagLength);
+
+            memcpy(accelFrame, plainText, payloadLength);
+            SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, accelFrame, payloadLength));
+
+            SetAesAccelSupported(false);
+            memcpy(frame, plainText, payloadLength);
+            SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, frame, payloadLength));
+            VerifyOrQuit(memcmp(frame, accelFrame, payloadLength + tagLength) == 0);
+            SetAesAccelSupported(true);
+
+            SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kDecrypt, accelFrame, payloadLength));
+            VerifyOrQuit(memcmp(accelFrame, plainText, payloadLength) == 0);
+
+            frame[Random::NonCrypto::GenerateUpToExcluding<uint16_t>(payloadLength + tagLength)] ^= 0x80;
+            VerifyOrQuit(aesCcm.Process(Crypto::AesCcm::kDecrypt, frame, payloadLength) == kErrorSecurity);
+        }
+
+        testFreeInstance(instance);
+
+        printf("\nTestAesCcmAccel PASSED\n");
+    }
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    static void TestAesCcmAccelPerformance(void)
+    {
+        TestAesCcmPerformance("accelerated");
+        SetAesAccelSupported(false);
+        TestAesCcmPerformance("otPlatCryptoAes");
+        SetAesAccelSupported(true);
+    }
+#endif
+};
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+
 } // namespace ot
 
 int main(void)
@@ -457,6 +630,16 @@ int main(void)
     ot::TestAesCcmMessageProcessing();
 #if OPENTHREAD_CONFIG_CRYPTO_PLATFORM_CCM_ONE_SHOT_ENABLE
     ot::TestPlatformCcmSinglePart();
+#endif
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+    ot::UnitTester::TestAesCcmAccel();
+#endif
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+#if OPENTHREAD_CONFIG_CRYPTO_AES_ACCEL_ENABLE
+    ot::UnitTester::TestAesCcmAccelPerformance();
+#else
+    ot::TestAesCcmPerformance("otPlatCryptoAes");
+#endif
 #endif
     printf("All tests passed\n");
     return 0;
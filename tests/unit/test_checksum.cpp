@@ -467,8 +467,113 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestSplitData(void)
+    {
+        // Verify that adding data as a sequence of chunks split at
+        // arbitrary (including odd) offsets gives the same checksum as
+        // adding it at once.
+
+        constexpr uint16_t kMaxLength     = 300;
+        constexpr uint16_t kNumIterations = 2000;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kMaxLength];
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxLength + 1);
+            uint16_t offset = 0;
+            Checksum checksum;
+
+            Random::NonCrypto::FillBuffer(buffer, length);
+
+            if (iter % 16 == 0)
+            {
+                // Use all `0xff` bytes to check the one's complement
+                // representation of zero.
+                memset(buffer, 0xff, length);
+            }
+
+            while (offset < length)
+            {
+                uint16_t chunkLength = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(length - offset + 1);
+
+                checksum.AddData(&buffer[offset], chunkLength);
+                offset += chunkLength;
+            }
+
+            VerifyOrQuit(checksum.GetValue() == CalculateChecksum(buffer, length));
+        }
+    }
 };
 
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+void TestMessageChecksumPerformance(void)
+{
+    constexpr uint16_t kSizes[]    = {64, 127, 512, 1280};
+    constexpr uint16_t kIterations = 2000;
+
+    const char *kSourceAddress = "fd00:1122:3344:5566:7788:99aa:bbcc:ddee";
+    const char *kDestAddress   = "fd01:2345:6789:abcd:ef01:2345:6789:abcd";
+
+    Instance        *instance = static_cast<Instance *>(testInitInstance());
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(instance != nullptr);
+
+    SuccessOrQuit(messageInfo.GetSockAddr().FromString(kSourceAddress));
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString(kDestAddress));
+
+    printf("\nTestMessageChecksumPerformance\n");
+
+    for (uint16_t size : kSizes)
+    {
+        Message       *message = instance->Get<Ip6::Ip6>().NewMessage();
+        Ip6::UdpHeader udpHeader;
+        uint8_t        buffer[1280];
+        uint64_t       startTime;
+        uint64_t       duration;
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->SetLength(size));
+
+        Random::NonCrypto::Fill(udpHeader);
+        udpHeader.SetChecksum(0);
+        message->Write(0, udpHeader);
+
+        Random::NonCrypto::FillBuffer(buffer, size - sizeof(udpHeader));
+        message->WriteBytes(sizeof(udpHeader), buffer, size - sizeof(udpHeader));
+
+        startTime = GetWallClockUsec();
+
+        for (uint16_t iter = 0; iter < kIterations; iter++)
+        {
+            Checksum::UpdateMessageChecksum(*message, messageInfo.GetSockAddr(), messageInfo.GetPeerAddr(),
+                                            Ip6::kProtoUdp);
+            SuccessOrQuit(Checksum::VerifyMessageChecksum(*message, messageInfo, Ip6::kProtoUdp));
+        }
+
+        duration = GetWallClockUsec() - startTime;
+
+        printf("size:%4u -> %.3f usec/packet", size, static_cast<double>(duration) / (2 * kIterations));
+
+        if (duration > 0)
+        {
+            printf(", %.1f MB/s", static_cast<double>(size) * 2 * kIterations / duration);
+        }
+
+        printf("\n");
+
+        message->Free();
+    }
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
 
 void TestVerhoeffChecksum(void)
@@ -530,11 +635,15 @@ void TestVerhoeffChecksum(void)
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestSplitData();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    ot::TestMessageChecksumPerformance();
+#endif
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
     ot::TestVerhoeffChecksum();
 #endif
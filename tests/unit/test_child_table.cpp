@@ -394,11 +394,117 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+static const Child *FindChildBySearch(ChildTable &aTable, const Child::AddressMatcher &aMatcher)
+{
+    const Child *match = nullptr;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        const Child *child = aTable.GetChildAtIndex(index);
+
+        if (aMatcher.Matches(*child))
+        {
+            match = child;
+            break;
+        }
+    }
+
+    return match;
+}
+
+static void VerifyChildTableLookups(ChildTable &aTable)
+{
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        const Child *child = aTable.GetChildAtIndex(index);
+
+        for (Child::StateFilter filter : kAllFilters)
+        {
+            Child::AddressMatcher rlocMatcher(child->GetRloc16(), filter);
+            Child::AddressMatcher extMatcher(child->GetExtAddress(), filter);
+
+            VerifyOrQuit(aTable.FindChild(child->GetRloc16(), filter) == FindChildBySearch(aTable, rlocMatcher));
+            VerifyOrQuit(aTable.FindChild(child->GetExtAddress(), filter) == FindChildBySearch(aTable, extMatcher));
+        }
+    }
+}
+
+void TestChildTableIndex(void)
+{
+    ChildTable *table;
+    uint16_t    numChildren;
+
+    printf("Test ChildTable index");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table       = &sInstance->Get<ChildTable>();
+    numChildren = table->GetMaxChildrenAllowed();
+
+    // Fill the table, using states and addresses which cause
+    // collisions in the index.
+
+    for (uint16_t i = 0; i < numChildren; i++)
+    {
+        Child          *child = table->GetNewChild();
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != nullptr);
+
+        extAddress.Clear();
+        extAddress.m8[6] = static_cast<uint8_t>(i >> 8);
+        extAddress.m8[7] = static_cast<uint8_t>(i & 0xff);
+
+        child->SetState((i % 3 == 0) ? Child::kStateRestored : Child::kStateValid);
+        child->SetRloc16(0x8000 + (i % 4 == 0 ? (i + 1) : (i % (numChildren / 2)) + 1));
+        child->SetExtAddress(extAddress);
+    }
+
+    VerifyChildTableLookups(*table);
+
+    // Change addresses and states of a subset of children.
+
+    for (uint16_t i = 0; i < numChildren; i += 3)
+    {
+        Child          *child      = table->GetChildAtIndex(i);
+        Mac::ExtAddress extAddress = child->GetExtAddress();
+
+        extAddress.m8[0] = 0xaa;
+        child->SetExtAddress(extAddress);
+        child->SetRloc16(0x8000 + numChildren - i);
+        VerifyChildTableLookups(*table);
+    }
+
+    for (uint16_t i = 0; i < numChildren; i += 2)
+    {
+        Child *child = table->GetChildAtIndex(i);
+
+        child->SetState((i % 4 == 0) ? Child::kStateInvalid : Child::kStateChildIdRequest);
+        VerifyChildTableLookups(*table);
+    }
+
+    // Clear remaining children one by one.
+
+    for (uint16_t i = 0; i < numChildren; i++)
+    {
+        table->GetChildAtIndex(numChildren - i - 1)->Clear();
+        VerifyChildTableLookups(*table);
+    }
+
+    VerifyOrQuit(!table->HasChildren(Child::kInStateAnyExceptInvalid));
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndex();
     printf("\nAll tests passed.\n");
     return 0;
 }
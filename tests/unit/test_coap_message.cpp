@@ -31,6 +31,14 @@
 #include "test_platform.h"
 #include "test_util.hpp"
 
+static uint32_t sNow = 10000;
+
+extern "C" {
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
 namespace ot {
 
 class UnitTester
@@ -417,6 +425,570 @@ public:
         message->Free();
         testFreeInstance(instance);
     }
+
+    static Coap::CoapBase::ResponseCache &GetResponseCache(Instance &aInstance)
+    {
+        return aInstance.Get<Tmf::Agent>().mResponseCache;
+    }
+
+    static void AddCachedResponse(Instance               &aInstance,
+                                  uint16_t                aMessageId,
+                                  uint16_t                aPayloadLength,
+                                  const Ip6::MessageInfo &aMessageInfo,
+                                  uint32_t                aExchangeLifetime)
+    {
+        Coap::Message *message;
+
+        message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+
+        SuccessOrQuit(message->Init(Coap::kTypeAck, Coap::kCodeChanged));
+        message->WriteMessageId(aMessageId);
+
+        if (aPayloadLength > 0)
+        {
+            SuccessOrQuit(message->AppendPayloadMarker());
+
+            for (uint16_t count = 0; count < aPayloadLength; count++)
+            {
+                SuccessOrQuit(message->Append<uint8_t>(static_cast<uint8_t>(count)));
+            }
+        }
+
+        {
+            Coap::Msg msg(*message, aMessageInfo);
+
+            SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+            GetResponseCache(aInstance).Add(msg, aExchangeLifetime);
+        }
+
+        message->Free();
+    }
+
+    static bool IsResponseCached(Instance &aInstance, uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+    {
+        Coap::Message *message;
+        bool           isCached;
+
+        message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+
+        SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodeGet));
+        message->WriteMessageId(aMessageId);
+
+        {
+            Coap::Msg msg(*message, aMessageInfo);
+
+            SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+            isCached = (GetResponseCache(aInstance).FindMatching(msg) != nullptr);
+        }
+
+        message->Free();
+
+        return isCached;
+    }
+
+    static uint16_t GetNumCachedResponses(const Coap::CoapBase::ResponseCache &aCache)
+    {
+        MessageQueue::Info info;
+        uint16_t           numFreeEntries = 0;
+
+        aCache.GetInfo(info);
+
+        for (const Coap::CoapBase::ResponseCache::IndexEntry *entry = aCache.mFreeEntries; entry != nullptr;
+             entry                                                  = entry->mNext)
+        {
+            numFreeEntries++;
+        }
+
+        // Validate that the index is consistent with the queue.
+        VerifyOrQuit(info.mNumMessages + numFreeEntries == Coap::CoapBase::ResponseCache::kMaxCacheSize);
+
+        return info.mNumMessages;
+    }
+
+    static void TestCoapResponseCache(void)
+    {
+        static constexpr uint16_t kMaxCacheSize  = Coap::CoapBase::ResponseCache::kMaxCacheSize;
+        static constexpr uint32_t kMaxCacheBytes = Coap::CoapBase::ResponseCache::kMaxCacheBytes;
+        static constexpr uint16_t kPayloadLength = 10;
+        static constexpr uint32_t kLifetime      = 10000;
+
+        static const uint16_t kLookupMessageIds[] = {0x1000, 0x1001};
+
+        Instance                      *instance;
+        Coap::CoapBase::ResponseCache *cache;
+        Ip6::MessageInfo               messageInfo;
+        Ip6::MessageInfo               otherMessageInfo;
+        Coap::Message                 *message;
+
+        printf("TestCoapResponseCache()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        cache = &GetResponseCache(*instance);
+        cache->RemoveAll();
+        cache->ResetCounters();
+
+        SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+        messageInfo.SetPeerPort(Tmf::kUdpPort);
+
+        otherMessageInfo = messageInfo;
+        otherMessageInfo.SetPeerPort(Tmf::kUdpPort + 1);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Fill the cache, validate lookups (matching message ID and peer).
+
+        for (uint16_t index = 0; index < kMaxCacheSize; index++)
+        {
+            AddCachedResponse(*instance, 0x1000 + index, kPayloadLength, messageInfo, kLifetime + index);
+            VerifyOrQuit(GetNumCachedResponses(*cache) == index + 1);
+        }
+
+        for (uint16_t index = 0; index < kMaxCacheSize; index++)
+        {
+            VerifyOrQuit(IsResponseCached(*instance, 0x1000 + index, messageInfo));
+            VerifyOrQuit(!IsResponseCached(*instance, 0x1000 + index, otherMessageInfo));
+        }
+
+        VerifyOrQuit(!IsResponseCached(*instance, 0x1000 + kMaxCacheSize, messageInfo));
+        VerifyOrQuit(cache->GetCounters().mEvictions == 0);
+
+        // Adding a response with the same message ID and peer is ignored.
+
+        AddCachedResponse(*instance, 0x1000, kPayloadLength, messageInfo, kLifetime);
+        VerifyOrQuit(GetNumCachedResponses(*cache) == kMaxCacheSize);
+        VerifyOrQuit(cache->GetCounters().mEvictions == 0);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Add a response with same message ID from a different peer.
+        // Validate that the response with the earliest expire time is
+        // evicted.
+
+        AddCachedResponse(*instance, 0x1000, kPayloadLength, otherMessageInfo, kLifetime + kMaxCacheSize);
+        VerifyOrQuit(GetNumCachedResponses(*cache) == kMaxCacheSize);
+        VerifyOrQuit(cache->GetCounters().mEvictions == 1);
+
+        VerifyOrQuit(!IsResponseCached(*instance, 0x1000, messageInfo));
+        VerifyOrQuit(IsResponseCached(*instance, 0x1000, otherMessageInfo));
+
+        for (uint16_t index = 1; index < kMaxCacheSize; index++)
+        {
+            VerifyOrQuit(IsResponseCached(*instance, 0x1000 + index, messageInfo));
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Validate hit and miss counters.
+
+        message = AsCoapMessagePtr(instance->Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodeGet));
+
+        for (uint16_t messageId : kLookupMessageIds)
+        {
+            Coap::Msg msg(*message, messageInfo);
+
+            message->WriteMessageId(messageId);
+            SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+            IgnoreError(cache->SendCachedResponse(msg, instance->Get<Tmf::Agent>()));
+        }
+
+        message->Free();
+
+        VerifyOrQuit(cache->GetCounters().mMisses == 1);
+        VerifyOrQuit(cache->GetCounters().mHits == 1);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Validate size-based eviction.
+
+        if (kMaxCacheBytes != 0)
+        {
+            uint16_t numCached   = GetNumCachedResponses(*cache);
+            uint16_t largeLength = static_cast<uint16_t>(kMaxCacheBytes / 2 - kPayloadLength);
+
+            AddCachedResponse(*instance, 0x2000, largeLength, messageInfo, 2 * kLifetime);
+            VerifyOrQuit(IsResponseCached(*instance, 0x2000, messageInfo));
+            VerifyOrQuit(cache->mCachedBytes <= kMaxCacheBytes);
+
+            AddCachedResponse(*instance, 0x2001, largeLength, messageInfo, 2 * kLifetime);
+            VerifyOrQuit(IsResponseCached(*instance, 0x2000, messageInfo));
+            VerifyOrQuit(IsResponseCached(*instance, 0x2001, messageInfo));
+            VerifyOrQuit(cache->mCachedBytes <= kMaxCacheBytes);
+            VerifyOrQuit(GetNumCachedResponses(*cache) < numCached);
+
+            // A response larger than the limit is not cached.
+
+            AddCachedResponse(*instance, 0x2002, static_cast<uint16_t>(kMaxCacheBytes), messageInfo, 2 * kLifetime);
+            VerifyOrQuit(!IsResponseCached(*instance, 0x2002, messageInfo));
+            VerifyOrQuit(IsResponseCached(*instance, 0x2000, messageInfo));
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Validate removal of expired responses.
+
+        AddCachedResponse(*instance, 0x3000, kPayloadLength, messageInfo, 0);
+        VerifyOrQuit(IsResponseCached(*instance, 0x3000, messageInfo));
+
+        cache->HandleTimer();
+        VerifyOrQuit(!IsResponseCached(*instance, 0x3000, messageInfo));
+        VerifyOrQuit(GetNumCachedResponses(*cache) > 0);
+
+        cache->RemoveAll();
+        VerifyOrQuit(GetNumCachedResponses(*cache) == 0);
+        VerifyOrQuit(cache->mCachedBytes == 0);
+
+        testFreeInstance(instance);
+    }
+
+    static void PrepareMessage(Coap::Message &aMessage,
+                               Coap::Type     aType,
+                               Coap::Code     aCode,
+                               uint16_t       aMessageId,
+                               uint16_t       aTokenId)
+    {
+        Coap::Token token;
+        uint8_t     tokenBytes[4];
+
+        tokenBytes[0] = static_cast<uint8_t>(aTokenId >> 8);
+        tokenBytes[1] = static_cast<uint8_t>(aTokenId & 0xff);
+        tokenBytes[2] = 0xaa;
+        tokenBytes[3] = 0x55;
+
+        SuccessOrQuit(aMessage.Init(aType, aCode, aMessageId));
+        SuccessOrQuit(token.SetToken(tokenBytes, sizeof(tokenBytes)));
+        SuccessOrQuit(aMessage.WriteToken(token));
+    }
+
+    static bool FindPendingRequest(Instance               &aInstance,
+                                   Coap::Type              aType,
+                                   uint16_t                aMessageId,
+                                   uint16_t                aTokenId,
+                                   const Ip6::MessageInfo &aMessageInfo,
+                                   uint16_t               *aRequestMessageId = nullptr)
+    {
+        Coap::CoapBase::PendingRequests &pendingRequests = aInstance.Get<Tmf::Agent>().mPendingRequests;
+        Coap::CoapBase::Request          request;
+        Coap::Message                   *message;
+        bool                             found;
+
+        message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+
+        PrepareMessage(*message, aType, Coap::kCodeChanged, aMessageId, aTokenId);
+
+        {
+            Coap::Msg msg(*message, aMessageInfo);
+
+            SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+            found = (pendingRequests.FindRelatedRequest(msg, request) == kErrorNone);
+        }
+
+        VerifyOrQuit(found == request.HasMessage());
+
+        if (found && (aRequestMessageId != nullptr))
+        {
+            *aRequestMessageId = request.GetMessage().ReadMessageId();
+        }
+
+        message->Free();
+
+        return found;
+    }
+
+    static void ValidatePendingRequests(Instance &aInstance, uint16_t aNumRequests)
+    {
+        const Coap::CoapBase::PendingRequests &pendingRequests = aInstance.Get<Tmf::Agent>().mPendingRequests;
+        MessageQueue::Info                     info;
+
+        pendingRequests.GetInfo(info);
+        VerifyOrQuit(info.mNumMessages == aNumRequests);
+
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        {
+            using PendingRequests = Coap::CoapBase::PendingRequests;
+
+            uint16_t numFreeEntries = 0;
+
+            for (const PendingRequests::IndexEntry *entry = pendingRequests.mFreeEntries; entry != nullptr;
+                 entry                                    = entry->mNextByToken)
+            {
+                numFreeEntries++;
+            }
+
+            VerifyOrQuit(pendingRequests.mHeapSize + numFreeEntries == PendingRequests::kIndexSize);
+            VerifyOrQuit(pendingRequests.mHeapSize + pendingRequests.mNumUnindexed == aNumRequests);
+
+            for (uint16_t index = 0; index < pendingRequests.mHeapSize; index++)
+            {
+                const PendingRequests::IndexEntry *entry = pendingRequests.mHeap[index];
+
+                VerifyOrQuit(entry->mHeapIndex == index);
+
+                if (index > 0)
+                {
+                    VerifyOrQuit(!(entry->mFireTime < pendingRequests.mHeap[(index - 1) / 2]->mFireTime));
+                }
+            }
+        }
+#endif
+    }
+
+    struct ResponseCounts
+    {
+        uint16_t mNumAborted;
+        uint16_t mNumTimedOut;
+    };
+
+    static void HandleResponse(void *aContext, Coap::Msg *aMsg, Error aResult)
+    {
+        ResponseCounts &counts = *static_cast<ResponseCounts *>(aContext);
+
+        VerifyOrQuit(aMsg == nullptr);
+
+        switch (aResult)
+        {
+        case kErrorAbort:
+            counts.mNumAborted++;
+            break;
+        case kErrorResponseTimeout:
+            counts.mNumTimedOut++;
+            break;
+        default:
+            VerifyOrQuit(false);
+        }
+    }
+
+    static void AddPendingRequest(Instance                            &aInstance,
+                                  const Ip6::MessageInfo              &aMessageInfo,
+                                  const Coap::CoapBase::SendCallbacks &aCallbacks,
+                                  uint16_t                             aMessageId,
+                                  uint16_t                             aTokenId)
+    {
+        Coap::Message          *message;
+        Coap::CoapBase::Request request;
+
+        message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+        VerifyOrQuit(message != nullptr);
+
+        PrepareMessage(*message, Coap::kTypeConfirmable, Coap::kCodePost, aMessageId, aTokenId);
+
+        {
+            Coap::Msg msg(*message, aMessageInfo);
+
+            SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+            SuccessOrQuit(aInstance.Get<Tmf::Agent>().mPendingRequests.Add(msg, Coap::TxParameters::GetDefault(),
+                                                                           aCallbacks, request));
+        }
+
+        message->Free();
+    }
+
+    static TimeMilli GetLatestFireTime(Instance &aInstance)
+    {
+        TimeMilli latest = TimerMilli::GetNow();
+
+        for (Coap::Message &message : aInstance.Get<Tmf::Agent>().mPendingRequests.mRequestMessages)
+        {
+            Coap::CoapBase::Request request;
+
+            request.InitFrom(message);
+            latest = Max(latest, request.GetTimerFireTime());
+        }
+
+        return latest;
+    }
+
+    static void TestCoapPendingRequests(void)
+    {
+        static constexpr uint16_t kNumRequests     = 50;
+        static constexpr uint16_t kFirstMessageId  = 0x4000;
+        static constexpr uint16_t kResponseIdDelta = 0x1000;
+
+        Instance                        *instance;
+        Coap::CoapBase::PendingRequests *pendingRequests;
+        Coap::CoapBase::SendCallbacks    callbacks;
+        Ip6::MessageInfo                 messageInfo;
+        Ip6::MessageInfo                 otherMessageInfo;
+        uint16_t                         numRemoved;
+        ResponseCounts                   counts;
+        uint32_t                         retxTimeouts[kNumRequests];
+
+        printf("TestCoapPendingRequests()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        pendingRequests = &instance->Get<Tmf::Agent>().mPendingRequests;
+        pendingRequests->AbortAllRequests();
+
+        callbacks.Clear();
+        callbacks.mResponseHandler = HandleResponse;
+        callbacks.mContext         = &counts;
+
+        counts.mNumAborted  = 0;
+        counts.mNumTimedOut = 0;
+
+        SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+        messageInfo.SetPeerPort(Tmf::kUdpPort);
+
+        otherMessageInfo = messageInfo;
+        SuccessOrQuit(otherMessageInfo.GetPeerAddr().FromString("fd00::2"));
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Add pending confirmable requests, each with a distinct message
+        // ID and token.
+
+        for (uint16_t index = 0; index < kNumRequests; index++)
+        {
+            AddPendingRequest(*instance, messageInfo, callbacks, kFirstMessageId + index, index);
+            ValidatePendingRequests(*instance, index + 1);
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Match Ack by message ID and Non-confirmable response by token.
+
+        for (uint16_t index = 0; index < kNumRequests; index++)
+        {
+            uint16_t messageId = kFirstMessageId + index;
+            uint16_t requestMessageId;
+
+            VerifyOrQuit(
+                FindPendingRequest(*instance, Coap::kTypeAck, messageId, index, messageInfo, &requestMessageId));
+            VerifyOrQuit(requestMessageId == messageId);
+
+            VerifyOrQuit(FindPendingRequest(*instance, Coap::kTypeNonConfirmable, messageId + kResponseIdDelta, index,
+                                            messageInfo, &requestMessageId));
+            VerifyOrQuit(requestMessageId == messageId);
+
+            VerifyOrQuit(!FindPendingRequest(*instance, Coap::kTypeAck, messageId, index, otherMessageInfo));
+            VerifyOrQuit(!FindPendingRequest(*instance, Coap::kTypeNonConfirmable, messageId, index, otherMessageInfo));
+        }
+
+        VerifyOrQuit(!FindPendingRequest(*instance, Coap::kTypeAck, kFirstMessageId + kNumRequests, 0, messageInfo));
+        VerifyOrQuit(!FindPendingRequest(*instance, Coap::kTypeNonConfirmable, kFirstMessageId, kNumRequests,
+                                         messageInfo));
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Remove every other request and validate the remaining ones are
+        // still matched.
+
+        numRemoved = 0;
+
+        for (uint16_t index = 0; index < kNumRequests; index += 2)
+        {
+            Coap::Message          *message;
+            Coap::CoapBase::Request request;
+
+            message = AsCoapMessagePtr(instance->Get<MessagePool>().Allocate(Message::kTypeOther));
+            VerifyOrQuit(message != nullptr);
+
+            PrepareMessage(*message, Coap::kTypeAck, Coap::kCodeEmpty, kFirstMessageId + index, index);
+
+            {
+                Coap::Msg msg(*message, messageInfo);
+
+                SuccessOrQuit(msg.ParseHeaderAndOptions(Coap::Msg::kRemovePayloadMarkerIfNoPayload));
+                SuccessOrQuit(pendingRequests->FindRelatedRequest(msg, request));
+                pendingRequests->Remove(request);
+            }
+
+            message->Free();
+            numRemoved++;
+            ValidatePendingRequests(*instance, kNumRequests - numRemoved);
+        }
+
+        for (uint16_t index = 0; index < kNumRequests; index++)
+        {
+            bool isRemoved = ((index % 2) == 0);
+
+            VerifyOrQuit(FindPendingRequest(*instance, Coap::kTypeAck, kFirstMessageId + index, index, messageInfo) ==
+                         !isRemoved);
+            VerifyOrQuit(FindPendingRequest(*instance, Coap::kTypeNonConfirmable, kFirstMessageId, index,
+                                            messageInfo) == !isRemoved);
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // No request is due yet, so handling the timer keeps all of them.
+
+        pendingRequests->HandleTimer();
+        ValidatePendingRequests(*instance, kNumRequests - numRemoved);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Abort all requests.
+
+        pendingRequests->AbortAllRequests();
+        ValidatePendingRequests(*instance, 0);
+        VerifyOrQuit(counts.mNumAborted == kNumRequests - numRemoved);
+        VerifyOrQuit(counts.mNumTimedOut == 0);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Add requests again and advance time past their retransmission
+        // timeouts. Each due request is retransmitted with a doubled
+        // timeout, and after all retransmissions it times out.
+
+        for (uint16_t index = 0; index < kNumRequests; index++)
+        {
+            AddPendingRequest(*instance, messageInfo, callbacks, kFirstMessageId + index, index);
+        }
+
+        ValidatePendingRequests(*instance, kNumRequests);
+
+        for (Coap::Message &message : pendingRequests->mRequestMessages)
+        {
+            Coap::CoapBase::Request request;
+
+            request.InitFrom(message);
+            retxTimeouts[message.ReadMessageId() - kFirstMessageId] = request.GetTimerFireTime() - TimerMilli::GetNow();
+        }
+
+        for (uint8_t retx = 0; retx < Coap::TxParameters::GetDefault().mMaxRetransmit; retx++)
+        {
+            // Move to the latest fire time so that all requests are due.
+
+            sNow = GetLatestFireTime(*instance).GetValue();
+            pendingRequests->HandleTimer();
+
+            ValidatePendingRequests(*instance, kNumRequests);
+            VerifyOrQuit(counts.mNumTimedOut == 0);
+
+            for (Coap::Message &message : pendingRequests->mRequestMessages)
+            {
+                Coap::CoapBase::Request request;
+                uint32_t               &retxTimeout = retxTimeouts[message.ReadMessageId() - kFirstMessageId];
+
+                request.InitFrom(message);
+
+                retxTimeout *= 2;
+                VerifyOrQuit(request.GetTimerFireTime() == TimerMilli::GetNow() + retxTimeout);
+
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+                {
+                    const Coap::CoapBase::PendingRequests::IndexEntry *entry;
+
+                    // Requests added when the index is full are not indexed
+                    // and are handled by `HandleTimersByScan()`.
+
+                    entry = pendingRequests->FindIndexEntry(message);
+
+                    if (entry != nullptr)
+                    {
+                        VerifyOrQuit(entry->mHeapIndex < pendingRequests->mHeapSize);
+                        VerifyOrQuit(entry->mFireTime == request.GetTimerFireTime());
+                    }
+                }
+#endif
+            }
+        }
+
+        sNow = GetLatestFireTime(*instance).GetValue();
+        pendingRequests->HandleTimer();
+
+        ValidatePendingRequests(*instance, 0);
+        VerifyOrQuit(counts.mNumTimedOut == kNumRequests);
+
+        testFreeInstance(instance);
+    }
 };
 
 } // namespace ot
@@ -424,6 +996,8 @@ public:
 int main(void)
 {
     ot::UnitTester::TestCoapMessage();
+    ot::UnitTester::TestCoapResponseCache();
+    ot::UnitTester::TestCoapPendingRequests();
     printf("All tests passed\n");
     return 0;
 }
@@ -1169,6 +1169,172 @@ void TestDnsCompressedName(void)
     testFreeInstance(instance);
 }
 
+void TestNameCompressor(void)
+{
+    static constexpr uint8_t kHeaderOffset       = 10;
+    static constexpr uint8_t kGuardBlockSize     = 20;
+    static constexpr uint8_t kDomainIndexInName1 = 10; // Index in name1 to the start of "default.service.arpa".
+
+    static const char kDomain[]       = "default.service.arpa.";
+    static const char kServiceType[]  = "_srv._udp";
+    static const char kInstance[]     = "Inst.One";
+    static const char kHostLabel[]    = "host";
+    static const char kOtherService[] = "_other._tcp.default.service.arpa";
+
+    // Expected encoded sizes of the appended names.
+    //
+    // - name1 "_srv._udp.default.service.arpa." is appended in full.
+    // - name2 "Inst.One" + pointer to name1.
+    // - name3 is same as name2 (different case) and uses a pointer.
+    // - name4 "host" + pointer to "default.service.arpa." in name1.
+    // - name5 "_other._tcp" + pointer to "default.service.arpa.".
+
+    static constexpr uint16_t kName1EncodedSize = 5 + 5 + 8 + 8 + 5 + 1;
+    static constexpr uint16_t kName2EncodedSize = 9 + 2;
+    static constexpr uint16_t kName3EncodedSize = 2;
+    static constexpr uint16_t kName4EncodedSize = 5 + 2;
+    static constexpr uint16_t kName5EncodedSize = 7 + 5 + 2;
+
+    static const char kExpectedReadName1[] = "_srv._udp.default.service.arpa.";
+    static const char kExpectedReadName2[] = "Inst.One._srv._udp.default.service.arpa.";
+    static const char kExpectedReadName4[] = "host.default.service.arpa.";
+    static const char kExpectedReadName5[] = "_other._tcp.default.service.arpa.";
+
+    Instance           *instance;
+    MessagePool        *messagePool;
+    Message            *message;
+    Dns::NameCompressor compressor;
+    Dns::Name::Buffer   name;
+    uint16_t            offset;
+    uint16_t            name1Offset;
+    uint16_t            name2Offset;
+    uint16_t            name3Offset;
+    uint16_t            name4Offset;
+    uint16_t            name5Offset;
+
+    printf("================================================================\n");
+    printf("TestNameCompressor()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    for (uint8_t index = 0; index < kHeaderOffset + kGuardBlockSize; index++)
+    {
+        SuccessOrQuit(message->Append(index));
+    }
+
+    message->SetOffset(kHeaderOffset);
+
+    name1Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(nullptr, kServiceType, kDomain, *message));
+    VerifyOrQuit(message->GetLength() - name1Offset == kName1EncodedSize);
+
+    name2Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kInstance, kServiceType, kDomain, *message));
+    VerifyOrQuit(message->GetLength() - name2Offset == kName2EncodedSize);
+
+    name3Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName("inst.one", "_SRV._UDP", "Default.Service.Arpa", *message));
+    VerifyOrQuit(message->GetLength() - name3Offset == kName3EncodedSize);
+
+    name4Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(nullptr, kHostLabel, kDomain, *message));
+    VerifyOrQuit(message->GetLength() - name4Offset == kName4EncodedSize);
+
+    name5Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kOtherService, *message));
+    VerifyOrQuit(message->GetLength() - name5Offset == kName5EncodedSize);
+
+    offset = name1Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName1) == 0);
+    VerifyOrQuit(offset == name2Offset);
+
+    offset = name2Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName2) == 0);
+    VerifyOrQuit(offset == name3Offset);
+
+    offset = name3Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName2) == 0);
+    VerifyOrQuit(offset == name4Offset);
+
+    offset = name4Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName4) == 0);
+    VerifyOrQuit(offset == name5Offset);
+
+    offset = name5Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName5) == 0);
+    VerifyOrQuit(offset == message->GetLength());
+
+    printf("Appended names with shared suffixes using compressor\n");
+
+    // Truncate the message to remove name4 and name5. The dictionary
+    // still has entries for them, but they no longer match the message
+    // content, so appending name5 again should not use a pointer to the
+    // removed bytes. Its "default.service.arpa." suffix from name1 is
+    // still used.
+
+    SuccessOrQuit(message->SetLength(name4Offset));
+
+    for (uint8_t index = 0; index < kGuardBlockSize; index++)
+    {
+        uint8_t value = 0xff;
+        SuccessOrQuit(message->Append(value));
+    }
+
+    name5Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(kOtherService, *message));
+    VerifyOrQuit(message->GetLength() - name5Offset == kName5EncodedSize);
+
+    offset = name5Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName5) == 0);
+
+    printf("Compressor ignores stale entries after message is truncated\n");
+
+    // Use a new compressor and add the name already present in the
+    // message using `AddName()`.
+
+    compressor.Clear();
+    compressor.AddName(kDomain, name1Offset + kDomainIndexInName1 - kHeaderOffset);
+
+    name4Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(nullptr, kHostLabel, kDomain, *message));
+    VerifyOrQuit(message->GetLength() - name4Offset == kName4EncodedSize);
+
+    offset = name4Offset;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName4) == 0);
+
+    // Add an entry with a wrong offset. It should not be used.
+
+    compressor.Clear();
+    compressor.AddName(kDomain, name1Offset - kHeaderOffset);
+
+    name4Offset = message->GetLength();
+    SuccessOrQuit(compressor.AppendName(nullptr, kHostLabel, kDomain, *message));
+    VerifyOrQuit(message->GetLength() - name4Offset == 5 + 8 + 8 + 5 + 1);
+
+    printf("Compressor uses names added to it\n");
+
+    // Invalid names
+
+    offset = message->GetLength();
+    VerifyOrQuit(compressor.AppendName("bad..name", *message) == kErrorInvalidArgs);
+    VerifyOrQuit(compressor.AppendName(nullptr, "bad", "..name", *message) == kErrorInvalidArgs);
+    VerifyOrQuit(message->GetLength() == offset);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 void TestHeaderAndResourceRecords(void)
 {
     static constexpr uint8_t  kHeaderOffset    = 0;
@@ -1877,6 +2043,7 @@ int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestNameCompressor();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
@@ -33,7 +33,7 @@
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
 
-#include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 namespace Ncp {
@@ -573,6 +573,41 @@ void TestEncoderDecoder(void)
 
     decoderBuffer.Clear();
 
+    // Test `Decoder` behavior when running out of buffer space, and that it recovers on the next frame
+
+    {
+        Spinel::FrameBuffer<sizeof(sMottoText) / 2> smallBuffer;
+        Hdlc::Decoder                                smallDecoder;
+
+        smallDecoder.Init(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(sMottoText, sizeof(sMottoText) - 1));
+        SuccessOrQuit(encoder.EndFrame());
+
+        decoderContext.mWasCalled = false;
+        smallDecoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with a full buffer");
+        VerifyOrQuit(memcmp(smallBuffer.GetFrame(), sMottoText, smallBuffer.GetLength()) == 0);
+
+        encoderBuffer.Clear();
+        smallBuffer.Clear();
+
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(sHdlcSpecials, sizeof(sHdlcSpecials)));
+        SuccessOrQuit(encoder.EndFrame());
+
+        decoderContext.mWasCalled = false;
+        smallDecoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(smallBuffer.GetLength() == sizeof(sHdlcSpecials));
+        VerifyOrQuit(memcmp(smallBuffer.GetFrame(), sHdlcSpecials, sizeof(sHdlcSpecials)) == 0);
+
+        encoderBuffer.Clear();
+    }
+
     // Test `Decoder` with back to back `kFlagSequence` and ensure callback is not invoked.
 
     byte                      = kFlagSequence;
@@ -626,8 +661,17 @@ void TestFuzzEncoderDecoder(void)
         VerifyOrQuit(!encoderBuffer.IsEmpty(), "Encoded frame is empty");
         VerifyOrQuit(encoderBuffer.GetLength() > length, "Encoded frame is too short");
 
+        // Feed the encoded frame to decoder in randomly sized chunks.
         decoderContext.mWasCalled = false;
-        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+        for (uint16_t offset = 0; offset < encoderBuffer.GetLength();)
+        {
+            uint16_t chunkLength = static_cast<uint16_t>(GetRandom(encoderBuffer.GetLength() - offset) + 1);
+
+            decoder.Decode(encoderBuffer.GetFrame() + offset, chunkLength);
+            offset += chunkLength;
+        }
+
         VerifyOrQuit(decoderContext.mWasCalled);
         VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
 
@@ -640,6 +684,65 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+void TestEncoderDecoderPerformance(void)
+{
+    static constexpr uint16_t kFrameLength = 1280;
+    static constexpr uint32_t kIterations  = 20000;
+
+    uint8_t                          frame[kFrameLength];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                   decoderContext;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::Decoder                    decoder;
+    uint64_t                         encodeTime = 0;
+    uint64_t                         decodeTime = 0;
+    uint64_t                         startTime;
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder performance");
+
+    // Typical spinel payload: mostly plain bytes with occasional
+    // special bytes that need escaping.
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    decoder.Init(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    for (uint32_t iter = 0; iter < kIterations; iter++)
+    {
+        encoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        startTime = GetWallClockUsec();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, kFrameLength));
+        SuccessOrQuit(encoder.EndFrame());
+        encodeTime += GetWallClockUsec() - startTime;
+
+        decoderContext.mWasCalled = false;
+
+        startTime = GetWallClockUsec();
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        decodeTime += GetWallClockUsec() - startTime;
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+        VerifyOrQuit(decoderBuffer.GetLength() == kFrameLength);
+    }
+
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, kFrameLength) == 0);
+
+    printf(" -- PASS (encode %.1f MB/s, decode %.1f MB/s)\n",
+           static_cast<double>(kFrameLength) * kIterations / OT_MAX(encodeTime, 1u),
+           static_cast<double>(kFrameLength) * kIterations / OT_MAX(decodeTime, 1u));
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
 } // namespace Ncp
 } // namespace ot
 
@@ -649,6 +752,9 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    ot::Ncp::TestEncoderDecoderPerformance();
+#endif
     printf("\nAll tests passed.\n");
     return 0;
 }
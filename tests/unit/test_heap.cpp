@@ -33,6 +33,7 @@
 #include <stdlib.h>
 
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -167,10 +168,126 @@ void TestAllocateMultiple(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
+/**
+ * Verifies the segregated-fit heap under a fragmenting mix of small and large allocations.
+ */
+void TestFragmentation(void)
+{
+    static constexpr uint32_t kNumIterations = 200000;
+    static constexpr uint16_t kMaxLive       = 1024;
+
+    struct Allocation
+    {
+        uint8_t *mPointer;
+        uint32_t mSize;
+    };
+
+    ot::Utils::Heap                heap;
+    Allocation                     allocations[kMaxLive];
+    uint16_t                       numLive     = 0;
+    uint32_t                       numFailed   = 0;
+    size_t                         minFreeSize = heap.GetFreeSize();
+    ot::Utils::Heap::SizeClassInfo info;
+
+    srand(0);
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        bool allocate = (numLive == 0) || ((numLive < kMaxLive) && (rand() % 2 == 0));
+
+        if (allocate)
+        {
+            // Mostly small allocations (e.g., names, records) with
+            // some larger ones (e.g., arrays being grown).
+
+            uint32_t size   = (rand() % 8 == 0) ? 257 + static_cast<uint32_t>(rand()) % 4000
+                                                : 1 + static_cast<uint32_t>(rand()) % 256;
+            uint8_t *buffer = static_cast<uint8_t *>(heap.CAlloc(1, size));
+
+            if (buffer == nullptr)
+            {
+                numFailed++;
+                continue;
+            }
+
+            VerifyOrQuit(reinterpret_cast<uintptr_t>(buffer) % sizeof(long) == 0);
+
+            for (uint32_t i = 0; i < size; i++)
+            {
+                VerifyOrQuit(buffer[i] == 0);
+            }
+
+            memset(buffer, static_cast<uint8_t>(size), size);
+            allocations[numLive].mPointer = buffer;
+            allocations[numLive].mSize    = size;
+            numLive++;
+            minFreeSize = ot::Min(minFreeSize, heap.GetFreeSize());
+        }
+        else
+        {
+            uint16_t    index      = static_cast<uint16_t>(static_cast<uint32_t>(rand()) % numLive);
+            Allocation &allocation = allocations[index];
+
+            for (uint32_t i = 0; i < allocation.mSize; i++)
+            {
+                VerifyOrQuit(allocation.mPointer[i] == static_cast<uint8_t>(allocation.mSize));
+            }
+
+            heap.Free(allocation.mPointer);
+            allocation = allocations[--numLive];
+        }
+    }
+
+    printf("TestFragmentation: %lu failed allocations, min free size %zu of %zu\n",
+           static_cast<unsigned long>(numFailed), minFreeSize, heap.GetCapacity());
+
+    for (uint8_t index = 0; index < ot::Utils::Heap::kNumSizeClasses; index++)
+    {
+        SuccessOrQuit(heap.GetSizeClassInfo(index, info));
+        printf("  block size %4lu: pages %3lu, allocated %4lu (max %4lu), allocs %6lu, failed %lu\n",
+               static_cast<unsigned long>(info.mBlockSize), static_cast<unsigned long>(info.mNumPages),
+               static_cast<unsigned long>(info.mNumAllocated), static_cast<unsigned long>(info.mMaxAllocated),
+               static_cast<unsigned long>(info.mNumAllocs), static_cast<unsigned long>(info.mNumFailedAllocs));
+    }
+
+    VerifyOrQuit(heap.GetSizeClassInfo(ot::Utils::Heap::kNumSizeClasses, info) == ot::kErrorNotFound);
+
+    while (numLive > 0)
+    {
+        heap.Free(allocations[--numLive].mPointer);
+    }
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == heap.GetCapacity());
+
+    for (uint8_t index = 0; index < ot::Utils::Heap::kNumSizeClasses; index++)
+    {
+        SuccessOrQuit(heap.GetSizeClassInfo(index, info));
+        VerifyOrQuit(info.mNumPages == 0 && info.mNumAllocated == 0);
+    }
+
+    // After freeing everything, the whole heap is available as a
+    // single block again.
+
+    {
+        void *p = heap.CAlloc(1, heap.GetCapacity());
+
+        VerifyOrQuit(p != nullptr && heap.GetFreeSize() == 0);
+        heap.Free(p);
+        VerifyOrQuit(heap.IsClean());
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT_ENABLE
+    TestFragmentation();
+#endif
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
@@ -1758,6 +1758,272 @@ static void TestErrorReservedNhc6(void)
     Test(testVector, false, true);
 }
 
+/***************************************************************************************************
+ * @section Context lookup tests.
+ **************************************************************************************************/
+
+static void TestContextLookup(void)
+{
+    struct LookupTest
+    {
+        const char *mAddress;
+        bool        mIsValid;
+        uint8_t     mContextId;
+        bool        mCompressFlag;
+    };
+
+    static const LookupTest kLookupTests[] = {
+        {"fd00:cafe:face:1234::1", true, 0, true},
+        {"2001:2:0:1:abcd:ef01:2345:6789", true, 1, true},
+        {"2001:2:0:2:abcd:ef01:2345:6789", true, 2, false},
+        {"2001:2:0:3:abcd:ef01:2345:6789", false, 0, false},
+        {"fd00:cafe:face:1235::1", false, 0, false},
+    };
+
+    NetworkData::Leader &leader = sInstance->Get<NetworkData::Leader>();
+    Lowpan::Context      context;
+    Ip6::Address         address;
+
+    printf("\n=== Test name: Context lookup ===\n\n");
+
+    for (const LookupTest &test : kLookupTests)
+    {
+        SuccessOrQuit(address.FromString(test.mAddress));
+        leader.FindContextForAddress(address, context);
+
+        VerifyOrQuit(context.IsValid() == test.mIsValid);
+
+        if (test.mIsValid)
+        {
+            Lowpan::Context idContext;
+
+            VerifyOrQuit(context.GetContextId() == test.mContextId);
+            VerifyOrQuit(context.GetCompressFlag() == test.mCompressFlag);
+            VerifyOrQuit(address.MatchesPrefix(context.GetPrefix()));
+
+            leader.FindContextForId(test.mContextId, idContext);
+            VerifyOrQuit(idContext.IsValid());
+            VerifyOrQuit(idContext.GetPrefix() == context.GetPrefix());
+        }
+    }
+
+    for (uint8_t contextId = 3; contextId < 16; contextId++)
+    {
+        leader.FindContextForId(contextId, context);
+        VerifyOrQuit(!context.IsValid());
+    }
+
+    printf("PASS\n\n");
+}
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+
+class UnitTester
+{
+public:
+    static bool IsContextCacheValid(void) { return sInstance->Get<NetworkData::Leader>().mIsContextCacheValid; }
+};
+
+#endif
+
+static void SetLeaderNetworkData(const uint8_t *aTlvs, uint16_t aLength)
+{
+    Message    *message;
+    OffsetRange offsetRange;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(aTlvs, aLength));
+    offsetRange.Init(0, aLength);
+
+    SuccessOrQuit(
+        sInstance->Get<NetworkData::Leader>().SetNetworkData(0, 0, NetworkData::kFullSet, *message, offsetRange));
+
+    message->Free();
+}
+
+static void VerifyContextForAddress(const char *aAddress, bool aIsValid, uint8_t aContextId = 0)
+{
+    Lowpan::Context context;
+    Ip6::Address    address;
+
+    SuccessOrQuit(address.FromString(aAddress));
+    sInstance->Get<NetworkData::Leader>().FindContextForAddress(address, context);
+
+    VerifyOrQuit(context.IsValid() == aIsValid);
+    VerifyOrQuit(!aIsValid || (context.GetContextId() == aContextId));
+}
+
+static void VerifyContextForId(uint8_t aContextId, const char *aAddress)
+{
+    // Verifies that the context for `aContextId` is valid and its
+    // prefix matches `aAddress`, or that it is invalid if `aAddress`
+    // is `nullptr`.
+
+    Lowpan::Context context;
+    Ip6::Address    address;
+
+    sInstance->Get<NetworkData::Leader>().FindContextForId(aContextId, context);
+
+    VerifyOrQuit(context.IsValid() == (aAddress != nullptr));
+
+    if (aAddress != nullptr)
+    {
+        SuccessOrQuit(address.FromString(aAddress));
+        VerifyOrQuit(address.MatchesPrefix(context.GetPrefix()));
+    }
+}
+
+static void TestContextLookupAfterNetDataChange(void)
+{
+    static constexpr uint8_t kNumPrefixes = 17;
+    static constexpr uint8_t kTlvsLength  = 10;
+
+    const uint8_t kNetworkData[] = {
+        // Prefix 2001:2:0:1::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x13, 0x40,                                                             // Context ID = 3, C = TRUE
+
+        // Prefix 2001:2:0:5::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x14, 0x40                                                              // Context ID = 4, C = TRUE
+    };
+
+    const uint8_t kRemovedContextIds[] = {1, 2, 5};
+
+    uint8_t  networkData[kNumPrefixes * kTlvsLength];
+    uint8_t *tlvs = networkData;
+
+    printf("\n=== Test name: Context lookup after Network Data change ===\n\n");
+
+    // Replace the Network Data: context IDs 1 and 2 are removed,
+    // 2001:2:0:1::/64 now uses context ID 3 and context ID 4 is new.
+
+    SetLeaderNetworkData(kNetworkData, sizeof(kNetworkData));
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    VerifyOrQuit(UnitTester::IsContextCacheValid());
+#endif
+
+    VerifyContextForAddress("2001:2:0:1:abcd:ef01:2345:6789", true, 3);
+    VerifyContextForAddress("2001:2:0:5:abcd:ef01:2345:6789", true, 4);
+    VerifyContextForAddress("2001:2:0:2:abcd:ef01:2345:6789", false);
+    VerifyContextForId(3, "2001:2:0:1::");
+    VerifyContextForId(4, "2001:2:0:5::");
+
+    for (uint8_t contextId : kRemovedContextIds)
+    {
+        VerifyContextForId(contextId, nullptr);
+    }
+
+    // Use more contexts than the cache can hold: 2000::/16 to
+    // 2010::/16 with context IDs 1 to 15 (then 1 and 2 again), so
+    // the lookups must fall back to searching the Network Data TLVs.
+    // The last prefix (2010::/16) is the one that does not fit.
+
+    for (uint8_t i = 0; i < kNumPrefixes; i++)
+    {
+        const uint8_t kPrefixTlv[kTlvsLength] = {
+            0x03, 0x08,                                   // Prefix TLV
+            0x00, 0x10, 0x20, i, 0x07, 0x02,              // 6LoWPAN Context ID TLV
+            static_cast<uint8_t>(0x10 | ((i % 15) + 1)), // Context ID, C = TRUE
+            0x10,
+        };
+
+        memcpy(tlvs, kPrefixTlv, sizeof(kPrefixTlv));
+        tlvs += sizeof(kPrefixTlv);
+    }
+
+    SetLeaderNetworkData(networkData, sizeof(networkData));
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    VerifyOrQuit(!UnitTester::IsContextCacheValid());
+#endif
+
+    VerifyContextForAddress("2000::1", true, 1);
+    VerifyContextForAddress("200e::1", true, 15);
+    VerifyContextForAddress("2010::1", true, 2);
+    VerifyContextForAddress("2011::1", false);
+
+    // When a Context ID is used by more than one prefix, the first one
+    // in the Network Data is used.
+
+    VerifyContextForId(1, "2000::");
+    VerifyContextForId(2, "2001::");
+    VerifyContextForId(15, "200e::");
+
+    // Going back to fewer contexts rebuilds the cache.
+
+    SetLeaderNetworkData(kNetworkData, sizeof(kNetworkData));
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_CACHE_ENABLE
+    VerifyOrQuit(UnitTester::IsContextCacheValid());
+#endif
+
+    VerifyContextForAddress("2001:2:0:1:abcd:ef01:2345:6789", true, 3);
+    VerifyContextForAddress("2000::1", false);
+    VerifyContextForId(1, nullptr);
+
+    printf("PASS\n\n");
+}
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+static void TestContextCompressionPerformance(void)
+{
+    static constexpr uint32_t kIterations = 20000;
+
+    uint8_t        frame[127];
+    uint16_t       frameLength;
+    uint64_t       compressTime   = 0;
+    uint64_t       decompressTime = 0;
+    uint64_t       startTime;
+    TestIphcVector testVector("Context compression performance");
+
+    printf("\n=== Test name: %s ===\n\n", testVector.mTestName);
+
+    testVector.SetMacSource(sTestMacSourceDefaultShort);
+    testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault), Ip6::kProtoIcmp6, 64,
+                           "2001:2:0:1:abcd:ef01:2345:6789", "fd00:cafe:face:1234:c31d:a702:0d41:beef");
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+
+    for (uint32_t iter = 0; iter < kIterations; iter++)
+    {
+        Message     *message;
+        FrameBuilder frameBuilder;
+        FrameData    frameData;
+
+        VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        testVector.GetUncompressedStream(*message);
+        frameBuilder.Init(frame, sizeof(frame));
+
+        startTime = GetWallClockUsec();
+        SuccessOrQuit(sLowpan->Compress(*message, testVector.mMacAddrs, frameBuilder));
+        compressTime += GetWallClockUsec() - startTime;
+
+        frameLength = frameBuilder.GetLength();
+        message->Free();
+
+        VerifyOrQuit((message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        frameData.Init(frame, frameLength);
+
+        startTime = GetWallClockUsec();
+        SuccessOrQuit(sLowpan->Decompress(*message, testVector.mMacAddrs, frameData, 0));
+        decompressTime += GetWallClockUsec() - startTime;
+
+        VerifyOrQuit(message->GetLength() == sizeof(Ip6::Header));
+        message->Free();
+    }
+
+    printf("Compress ---------------- %.3f usec/frame\n", static_cast<double>(compressTime) / kIterations);
+    printf("Decompress -------------- %.3f usec/frame\n", static_cast<double>(decompressTime) / kIterations);
+    printf("PASS\n\n");
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
 /***************************************************************************************************
  * @section Main test.
  **************************************************************************************************/
@@ -1851,6 +2117,13 @@ void TestLowpanIphc(void)
     TestErrorReservedNhc5();
     TestErrorReservedNhc6();
 
+    // 6LoWPAN context lookup tests.
+    TestContextLookup();
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    TestContextCompressionPerformance();
+#endif
+    TestContextLookupAfterNetDataChange();
+
     testFreeInstance(sInstance);
 }
 
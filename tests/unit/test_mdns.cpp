@@ -1761,7 +1761,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 //----------------------------------------------------------------------------------------------------------------------
 // Heap allocation
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 8000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
@@ -4620,7 +4620,14 @@ void TestQuery(void)
 
     VerifyOrQuit(sDnsMessages.IsEmpty());
 
-    // Wait for final announcement and validate it
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send a PTR query for `_srv._udp` before final announcement, validate only `service3` is answered");
+
+    // The answer is aggregated with the final announcement of
+    // `service1`. Since `service1` PTR record can no longer be
+    // answered, it should only be included as a goodbye.
+
+    SendQuery("_srv._udp.local.", ResourceRecord::kTypePtr);
 
     AdvanceTime(2000);
 
@@ -4628,7 +4635,7 @@ void TestQuery(void)
     VerifyOrQuit(dnsMsg != nullptr);
     VerifyOrQuit(dnsMsg->GetNext() == nullptr);
 
-    dnsMsg->ValidateHeader(kMulticastResponse, /* Q */ 0, /* Ans */ 5, /* Auth */ 0, /* Addnl */ 0);
+    dnsMsg->ValidateHeader(kMulticastResponse, /* Q */ 0, /* Ans */ 6, /* Auth */ 0, /* Addnl */ 4);
     dnsMsg->Validate(service1, kInAnswerSection, kCheckSrv | kCheckTxt | kCheckPtr, kGoodBye);
 
     for (uint16_t index = 0; index < service1.mSubTypeLabelsLength; index++)
@@ -4636,6 +4643,177 @@ void TestQuery(void)
         dnsMsg->ValidateSubType(service1.mSubTypeLabels[index], service1, kGoodBye);
     }
 
+    dnsMsg->Validate(service3, kInAnswerSection, kCheckPtr);
+    dnsMsg->Validate(service3, kInAdditionalSection, kCheckSrv | kCheckTxt);
+    dnsMsg->Validate(host2, kInAdditionalSection);
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+static void ReceiveQuery(const char *aName, uint16_t aRecordType)
+{
+    // Same as `SendQuery()` but without logging, so that it can be
+    // used when measuring the query processing time.
+
+    Message          *message;
+    Header            header;
+    Core::AddressInfo senderAddrInfo;
+
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    header.Clear();
+    header.SetType(Header::kTypeQuery);
+    header.SetQuestionCount(1);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(Name::AppendName(aName, *message));
+    SuccessOrQuit(message->Append(Question(aRecordType, ResourceRecord::kClassInternet)));
+
+    SuccessOrQuit(AsCoreType(&senderAddrInfo.mAddress).FromString(kDeviceIp6Address));
+    senderAddrInfo.mPort         = kMdnsPort;
+    senderAddrInfo.mInfraIfIndex = 0;
+
+    otPlatMdnsHandleReceive(sInstance, message, /* aIsUnicast */ false, &senderAddrInfo);
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
+void TestQueryManyServices(void)
+{
+    // The number of services is limited by the heap size when using
+    // the internal heap.
+    static constexpr uint16_t kNumServices = OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE ? 1000 : 100;
+    static constexpr uint16_t kNumTypes    = 4;
+
+    static const char *const kServiceTypes[kNumTypes] = {"_srv._udp", "_tst._tcp", "_abc._udp", "_xyz._tcp"};
+
+    Core             *mdns = InitTest();
+    Core::Host        host;
+    Core::Service     service;
+    Ip6::Address      hostAddress;
+    DnsNameString     instanceLabel;
+    DnsNameString     fullName;
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestQueryManyServices");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    SuccessOrQuit(hostAddress.FromString("fd00::1:aaaa"));
+    host.mHostName        = "host";
+    host.mAddresses       = &hostAddress;
+    host.mAddressesLength = 1;
+    host.mTtl             = 1500;
+
+    ClearAllBytes(service);
+    service.mHostName = host.mHostName;
+    service.mPort     = 1234;
+    service.mTtl      = 1500;
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Register a host and %u services of %u service types", kNumServices, kNumTypes);
+
+    SuccessOrQuit(mdns->RegisterHost(host, 0, HandleSuccessCallback));
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        instanceLabel.Clear();
+        instanceLabel.Append("srv%u", index);
+
+        service.mServiceInstance = instanceLabel.AsCString();
+        service.mServiceType     = kServiceTypes[index % kNumTypes];
+
+        SuccessOrQuit(mdns->RegisterService(service, 1, nullptr));
+    }
+
+    // Wait for probes and announcements to finish.
+
+    AdvanceTime(20 * 1000);
+    VerifyOrQuit(sRegCallbacks[0].mWasCalled);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send an SRV query for the last registered service and validate the answer");
+
+    sDnsMessages.Clear();
+
+    fullName.Clear();
+    fullName.Append("%s.%s.local.", service.mServiceInstance, service.mServiceType);
+    SendQuery(fullName.AsCString(), ResourceRecord::kTypeSrv);
+
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    dnsMsg->ValidateHeader(kMulticastResponse, /* Q */ 0, /* Ans */ 1, /* Auth */ 0, /* Addnl */ 2);
+    dnsMsg->Validate(service, kInAnswerSection, kCheckSrv);
+    dnsMsg->Validate(host, kInAdditionalSection);
+
+    AdvanceTime(2000);
+    sDnsMessages.Clear();
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    {
+        static constexpr uint16_t kNumRounds = 5;
+
+        uint32_t numQueries = 0;
+        uint64_t startTime;
+        uint64_t duration;
+
+        Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+        Log("Measure the time to process SRV, TXT, PTR and AAAA queries");
+
+        startTime = GetWallClockUsec();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint16_t index = 0; index < kNumServices; index++)
+            {
+                fullName.Clear();
+                fullName.Append("srv%u.%s.local.", index, kServiceTypes[index % kNumTypes]);
+
+                ReceiveQuery(fullName.AsCString(),
+                             (index % 2 == 0) ? ResourceRecord::kTypeSrv : ResourceRecord::kTypeTxt);
+                numQueries++;
+            }
+
+            for (const char *serviceType : kServiceTypes)
+            {
+                fullName.Clear();
+                fullName.Append("%s.local.", serviceType);
+
+                ReceiveQuery(fullName.AsCString(), ResourceRecord::kTypePtr);
+                numQueries++;
+            }
+
+            ReceiveQuery("host.local.", ResourceRecord::kTypeAaaa);
+            numQueries++;
+        }
+
+        duration = GetWallClockUsec() - startTime;
+
+        printf("\nTestQueryManyServices\n");
+        printf("  services: %u, queries: %lu, total: %lu usec, per query: %lu nsec\n", kNumServices,
+               ToUlong(numQueries), ToUlong(static_cast<uint32_t>(duration)),
+               ToUlong(static_cast<uint32_t>(duration * 1000 / numQueries)));
+    }
+#endif
+
     SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
     VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
 
@@ -9025,6 +9203,7 @@ int main(void)
     ot::Dns::Multicast::TestServiceSubTypeReg();
     ot::Dns::Multicast::TestHostOrServiceAndKeyReg();
     ot::Dns::Multicast::TestQuery();
+    ot::Dns::Multicast::TestQueryManyServices();
     ot::Dns::Multicast::TestMultiPacket();
     ot::Dns::Multicast::TestResponseAggregation();
     ot::Dns::Multicast::TestQuestionUnicastDisallowed();
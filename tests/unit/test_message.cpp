@@ -537,6 +537,110 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
+void TestLargeBuffers(void)
+{
+    static constexpr uint16_t kLargeLength   = 1000;
+    static constexpr uint16_t kPrependLength = 300;
+    static constexpr uint16_t kMaxLength     = kLargeLength + kPrependLength;
+
+    Instance    *instance;
+    MessagePool *messagePool;
+    Message     *message;
+    Message     *messages[OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS];
+    uint16_t     numLargeBuffers;
+    uint8_t      writeBuffer[kMaxLength];
+    uint8_t      readBuffer[kMaxLength];
+
+    printf("TestLargeBuffers");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool     = &instance->Get<MessagePool>();
+    numLargeBuffers = messagePool->GetTotalLargeBufferCount();
+
+    VerifyOrQuit(numLargeBuffers == OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS);
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxLength);
+
+    // A message grown to a large length at once uses large buffers.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer + kPrependLength, kLargeLength));
+    VerifyOrQuit(message->GetBufferCount() == 2);
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers - 1);
+
+    SuccessOrQuit(message->PrependBytes(writeBuffer, kPrependLength));
+    VerifyOrQuit(message->GetLength() == kMaxLength);
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers - 2);
+    SuccessOrQuit(message->Read(0, readBuffer, kMaxLength));
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMaxLength) == 0);
+
+    message->Free();
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers);
+
+    // Shrinking a message frees its large buffers.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->SetLength(kLargeLength));
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers - 1);
+    SuccessOrQuit(message->SetLength(10));
+    VerifyOrQuit(message->GetBufferCount() == 1);
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers);
+
+    // A message grown in small steps uses regular buffers.
+
+    for (uint16_t i = 0; i < kLargeLength; i++)
+    {
+        SuccessOrQuit(message->Append(writeBuffer[i]));
+    }
+
+    VerifyOrQuit(message->GetBufferCount() > 2);
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers);
+    SuccessOrQuit(message->Read(10, readBuffer, kLargeLength));
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kLargeLength) == 0);
+
+    message->Free();
+
+    // When all large buffers are in use, regular buffers are used.
+
+    for (Message *&largeMessage : messages)
+    {
+        VerifyOrQuit((largeMessage = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+        SuccessOrQuit(largeMessage->SetLength(kLargeLength));
+        VerifyOrQuit(largeMessage->GetBufferCount() == 2);
+    }
+
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == 0);
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kLargeLength));
+    VerifyOrQuit(message->GetBufferCount() > 2);
+    SuccessOrQuit(message->Read(0, readBuffer, kLargeLength));
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kLargeLength) == 0);
+    message->Free();
+
+    for (Message *largeMessage : messages)
+    {
+        largeMessage->Free();
+    }
+
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numLargeBuffers);
+    VerifyOrQuit(messagePool->GetMaxUsedLargeBufferCount() == numLargeBuffers);
+
+    messagePool->ResetMaxUsedBufferCount();
+    VerifyOrQuit(messagePool->GetMaxUsedLargeBufferCount() == 0);
+
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+
 } // namespace ot
 
 int main(void)
@@ -550,6 +654,9 @@ int main(void)
 
     ot::UnitTester::TestCloning();
     ot::TestAppender();
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_ENABLE
+    ot::TestLargeBuffers();
+#endif
 
     printf("All tests passed\n");
     return 0;
@@ -31,7 +31,9 @@
 #include "test_platform.h"
 #include "test_util.hpp"
 
+#include "common/random.hpp"
 #include "instance/instance.hpp"
+#include "net/checksum.hpp"
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -435,6 +437,376 @@ void TestNat64Counters(void)
     Log("End of TestNat64Counters");
 }
 
+void VerifyIp4TransportChecksum(Message &aMessage)
+{
+    // Verifies the (incrementally adjusted) TCP/UDP checksum in a
+    // translated IPv4 message against a full calculation.
+
+    Ip4::Headers headers;
+    uint16_t     checksum;
+
+    SuccessOrQuit(headers.ParseFrom(aMessage));
+    checksum = headers.GetChecksum();
+
+    aMessage.SetOffset(headers.GetIp4Header().GetHeaderLength());
+    Checksum::UpdateMessageChecksum(aMessage, headers.GetSourceAddress(), headers.GetDestinationAddress(),
+                                    headers.GetIpProto());
+    aMessage.SetOffset(0);
+
+    SuccessOrQuit(headers.ParseFrom(aMessage));
+    VerifyOrQuit(headers.GetChecksum() == checksum);
+}
+
+void VerifyIp6TransportChecksum(Message &aMessage)
+{
+    // Verifies the (incrementally adjusted) TCP/UDP checksum in a
+    // translated IPv6 message against a full calculation.
+
+    Ip6::Headers headers;
+    uint16_t     checksum;
+
+    SuccessOrQuit(headers.ParseFrom(aMessage));
+    checksum = headers.GetChecksum();
+
+    aMessage.SetOffset(sizeof(Ip6::Header));
+    Checksum::UpdateMessageChecksum(aMessage, headers.GetSourceAddress(), headers.GetDestinationAddress(),
+                                    headers.GetIpProto());
+    aMessage.SetOffset(0);
+
+    SuccessOrQuit(headers.ParseFrom(aMessage));
+    VerifyOrQuit(headers.GetChecksum() == checksum);
+}
+
+void TestNat64ChecksumAdjustment(void)
+{
+    static constexpr uint16_t kMaxPayloadLength = 600;
+    static constexpr uint16_t kNumIterations    = 200;
+
+    Ip6::Prefix  prefix;
+    Ip4::Cidr    cidr;
+    Ip4::Address translatedAddress;
+    Ip4::Address serverIp4Address;
+    Ip6::Address clientAddress;
+    Ip6::Address serverIp6Address;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64ChecksumAdjustment");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("192.168.123.1/32"));
+    SuccessOrQuit(translatedAddress.FromString("192.168.123.1"));
+    SuccessOrQuit(serverIp4Address.FromString("172.16.243.197"));
+    SuccessOrQuit(clientAddress.FromString("fd02::1"));
+    serverIp6Address.SynthesizeFromIp4Address(prefix, serverIp4Address);
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        uint8_t        ipProto    = (iter % 2 == 0) ? Ip6::kProtoUdp : Ip6::kProtoTcp;
+        uint16_t       headerSize = (ipProto == Ip6::kProtoUdp) ? sizeof(Ip6::UdpHeader) : sizeof(Ip6::TcpHeader);
+        uint16_t       payloadLength = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxPayloadLength);
+        uint16_t       serverPort    = Random::NonCrypto::Generate<uint16_t>();
+        uint16_t       translatedPort;
+        Message       *message;
+        Ip6::Header    ip6Header;
+        Ip4::Header    ip4Header;
+        uint16_t       port;
+        Ip6::TcpHeader tcpHeader;
+        Ip6::UdpHeader udpHeader;
+        uint8_t        payload[kMaxPayloadLength];
+
+        Random::NonCrypto::FillBuffer(payload, payloadLength);
+
+        // Outbound IPv6 datagram from the client to the server (via
+        // NAT64 prefix) with a valid checksum.
+
+        ip6Header.InitVersionTrafficClassFlow();
+        ip6Header.SetPayloadLength(headerSize + payloadLength);
+        ip6Header.SetNextHeader(ipProto);
+        ip6Header.SetHopLimit(64);
+        ip6Header.SetSource(clientAddress);
+        ip6Header.SetDestination(serverIp6Address);
+
+        message = sInstance->Get<Ip6::Ip6>().NewMessage();
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(ip6Header));
+
+        if (ipProto == Ip6::kProtoUdp)
+        {
+            udpHeader.Clear();
+            udpHeader.SetSourcePort(43981);
+            udpHeader.SetDestinationPort(serverPort);
+            udpHeader.SetLength(headerSize + payloadLength);
+            SuccessOrQuit(message->Append(udpHeader));
+        }
+        else
+        {
+            tcpHeader.Clear();
+            tcpHeader.SetSourcePort(43981);
+            tcpHeader.SetDestinationPort(serverPort);
+            tcpHeader.SetChecksum(0);
+            SuccessOrQuit(message->Append(tcpHeader));
+        }
+
+        SuccessOrQuit(message->AppendBytes(payload, payloadLength));
+
+        message->SetOffset(sizeof(Ip6::Header));
+        Checksum::UpdateMessageChecksum(*message, clientAddress, serverIp6Address, ipProto);
+        message->SetOffset(0);
+
+        SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+        VerifyIp4TransportChecksum(*message);
+
+        // Source port is the first field in both UDP and TCP headers.
+        SuccessOrQuit(message->Read(sizeof(Ip4::Header), port));
+        translatedPort = BigEndian::HostSwap16(port);
+        message->Free();
+
+        // Inbound IPv4 reply from the server to the translated
+        // address and port.
+
+        ip4Header.Clear();
+        ip4Header.InitVersionIhl();
+        ip4Header.SetTotalLength(sizeof(Ip4::Header) + headerSize + payloadLength);
+        ip4Header.SetProtocol(ipProto);
+        ip4Header.SetTtl(64);
+        ip4Header.SetSource(serverIp4Address);
+        ip4Header.SetDestination(translatedAddress);
+        Checksum::UpdateIp4HeaderChecksum(ip4Header);
+
+        message = sInstance->Get<Ip6::Ip6>().NewMessage();
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(ip4Header));
+
+        if (ipProto == Ip6::kProtoUdp)
+        {
+            udpHeader.SetSourcePort(serverPort);
+            udpHeader.SetDestinationPort(translatedPort);
+            udpHeader.SetChecksum(0);
+            SuccessOrQuit(message->Append(udpHeader));
+        }
+        else
+        {
+            tcpHeader.SetSourcePort(serverPort);
+            tcpHeader.SetDestinationPort(translatedPort);
+            tcpHeader.SetChecksum(0);
+            SuccessOrQuit(message->Append(tcpHeader));
+        }
+
+        SuccessOrQuit(message->AppendBytes(payload, payloadLength));
+
+        // Every fourth UDP datagram is sent without checksum (zero
+        // value) which is allowed in IPv4 but not in IPv6.
+
+        if ((ipProto == Ip6::kProtoTcp) || (iter % 4 != 0))
+        {
+            message->SetOffset(sizeof(Ip4::Header));
+            Checksum::UpdateMessageChecksum(*message, ip4Header.GetSource(), ip4Header.GetDestination(), ipProto);
+            message->SetOffset(0);
+        }
+
+        SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+        VerifyIp6TransportChecksum(*message);
+        message->Free();
+    }
+
+    Log("End of TestNat64ChecksumAdjustment");
+
+    testFreeInstance(sInstance);
+}
+
+void TestNat64MappingTable(void)
+{
+    static constexpr uint16_t kNumClients = 200;
+    static constexpr uint16_t kPayloadLen = 8;
+
+    Ip6::Prefix                         prefix;
+    Ip4::Cidr                           cidr;
+    Ip4::Address                        serverIp4Address;
+    Ip6::Address                        serverIp6Address;
+    Ip4::Address                        translatedAddresses[kNumClients];
+    Translator::AddressMappingIterator  iter;
+    Translator::AddressMapping          mapping;
+    Translator::MappingLookupCounters   lookupCounters;
+    uint16_t                            numMappings;
+    uint8_t                             payload[kPayloadLen];
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingTable");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("10.1.0.0/16"));
+    SuccessOrQuit(serverIp4Address.FromString("172.16.243.197"));
+    serverIp6Address.SynthesizeFromIp4Address(prefix, serverIp4Address);
+    memset(payload, 0x5a, sizeof(payload));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    lookupCounters = sInstance->Get<Translator>().GetMappingLookupCounters();
+    VerifyOrQuit(lookupCounters.mLookups == 0);
+
+    // Send datagrams from many clients (twice) and verify that each
+    // client keeps using the same mapping.
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        for (uint16_t i = 0; i < kNumClients; i++)
+        {
+            Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+            Ip6::Header    ip6Header;
+            Ip4::Header    ip4Header;
+            Ip6::UdpHeader udpHeader;
+            Ip6::Address   clientAddress;
+
+            SuccessOrQuit(clientAddress.FromString("fd02::"));
+            clientAddress.mFields.m16[7] = BigEndian::HostSwap16(i + 1);
+
+            ip6Header.InitVersionTrafficClassFlow();
+            ip6Header.SetPayloadLength(sizeof(udpHeader) + kPayloadLen);
+            ip6Header.SetNextHeader(Ip6::kProtoUdp);
+            ip6Header.SetHopLimit(64);
+            ip6Header.SetSource(clientAddress);
+            ip6Header.SetDestination(serverIp6Address);
+
+            udpHeader.Clear();
+            udpHeader.SetSourcePort(1000 + i);
+            udpHeader.SetDestinationPort(5683);
+            udpHeader.SetLength(sizeof(udpHeader) + kPayloadLen);
+
+            VerifyOrQuit(message != nullptr);
+            SuccessOrQuit(message->Append(ip6Header));
+            SuccessOrQuit(message->Append(udpHeader));
+            SuccessOrQuit(message->AppendBytes(payload, kPayloadLen));
+
+            SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+            SuccessOrQuit(message->Read(0, ip4Header));
+
+            if (round == 0)
+            {
+                translatedAddresses[i] = ip4Header.GetSource();
+            }
+            else
+            {
+                VerifyOrQuit(translatedAddresses[i] == ip4Header.GetSource());
+            }
+
+            message->Free();
+        }
+    }
+
+    numMappings = 0;
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(mapping) == kErrorNone)
+    {
+        numMappings++;
+    }
+
+    VerifyOrQuit(numMappings == kNumClients);
+
+    // Send replies to each client and verify that each one is
+    // translated to the corresponding client address.
+
+    for (uint16_t i = 0; i < kNumClients; i++)
+    {
+        Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+        Ip4::Header    ip4Header;
+        Ip6::Header    ip6Header;
+        Ip6::UdpHeader udpHeader;
+
+        ip4Header.Clear();
+        ip4Header.InitVersionIhl();
+        ip4Header.SetTotalLength(sizeof(ip4Header) + sizeof(udpHeader) + kPayloadLen);
+        ip4Header.SetProtocol(Ip4::kProtoUdp);
+        ip4Header.SetTtl(64);
+        ip4Header.SetSource(serverIp4Address);
+        ip4Header.SetDestination(translatedAddresses[i]);
+        Checksum::UpdateIp4HeaderChecksum(ip4Header);
+
+        udpHeader.Clear();
+        udpHeader.SetSourcePort(5683);
+        udpHeader.SetDestinationPort(1000 + i);
+        udpHeader.SetLength(sizeof(udpHeader) + kPayloadLen);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(ip4Header));
+        SuccessOrQuit(message->Append(udpHeader));
+        SuccessOrQuit(message->AppendBytes(payload, kPayloadLen));
+
+        SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+        SuccessOrQuit(message->Read(0, ip6Header));
+
+        VerifyOrQuit(ip6Header.GetDestination().mFields.m16[7] == BigEndian::HostSwap16(i + 1));
+
+        message->Free();
+    }
+
+    lookupCounters = sInstance->Get<Translator>().GetMappingLookupCounters();
+
+    Log("Lookups: %lu, Misses: %lu, Probes: %lu, MaxProbes: %lu", ToUlong(lookupCounters.mLookups),
+        ToUlong(lookupCounters.mMisses), ToUlong(lookupCounters.mProbes), ToUlong(lookupCounters.mMaxProbes));
+
+    // Each client misses once when its mapping is created and then
+    // hits once per direction. Probing for a free port or address
+    // when allocating a mapping is not counted.
+
+    VerifyOrQuit(lookupCounters.mLookups == 3 * kNumClients);
+    VerifyOrQuit(lookupCounters.mMisses == kNumClients);
+    VerifyOrQuit(lookupCounters.mProbes < 2 * lookupCounters.mLookups);
+
+    // Change the CIDR which removes all mappings. Verify that replies
+    // are then dropped.
+
+    SuccessOrQuit(cidr.FromString("10.2.0.0/16"));
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+
+    iter.Init(*sInstance);
+    VerifyOrQuit(iter.GetNext(mapping) == kErrorNotFound);
+
+    {
+        Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+        Ip4::Header    ip4Header;
+        Ip6::UdpHeader udpHeader;
+
+        ip4Header.Clear();
+        ip4Header.InitVersionIhl();
+        ip4Header.SetTotalLength(sizeof(ip4Header) + sizeof(udpHeader) + kPayloadLen);
+        ip4Header.SetProtocol(Ip4::kProtoUdp);
+        ip4Header.SetTtl(64);
+        ip4Header.SetSource(serverIp4Address);
+        ip4Header.SetDestination(translatedAddresses[0]);
+        Checksum::UpdateIp4HeaderChecksum(ip4Header);
+
+        udpHeader.Clear();
+        udpHeader.SetSourcePort(5683);
+        udpHeader.SetDestinationPort(1000);
+        udpHeader.SetLength(sizeof(udpHeader) + kPayloadLen);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(ip4Header));
+        SuccessOrQuit(message->Append(udpHeader));
+        SuccessOrQuit(message->AppendBytes(payload, kPayloadLen));
+
+        VerifyOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message) == kErrorDrop);
+        message->Free();
+    }
+
+    Log("End of TestNat64MappingTable");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace Nat64
 } // namespace ot
 
@@ -445,6 +817,8 @@ int main(void)
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     ot::Nat64::TestNat64Translation();
     ot::Nat64::TestNat64Counters();
+    ot::Nat64::TestNat64ChecksumAdjustment();
+    ot::Nat64::TestNat64MappingTable();
     printf("All tests passed\n");
 #else
     printf("NAT64 is not enabled\n");
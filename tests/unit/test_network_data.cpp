@@ -1066,6 +1066,300 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
 }
 
 } // namespace NetworkData
+
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+
+class UnitTester
+{
+public:
+    static void TestNetworkDataRouteCache(void);
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    static void TestNetworkDataRouteCachePerformance(void);
+#endif
+
+private:
+    struct TestPrefix
+    {
+        uint8_t mPrefix[OT_IP6_ADDRESS_SIZE];
+        uint8_t mLength;
+    };
+
+    static uint32_t GetNextRandom(void);
+    static void     GenerateNetworkData(NetworkData::Leader &aLeader);
+    static void     GenerateAddress(Ip6::Address &aAddress);
+
+    static const TestPrefix kTestPrefixes[];
+    static uint32_t         sRandomSeed;
+};
+
+const UnitTester::TestPrefix UnitTester::kTestPrefixes[] = {
+    {{0}, 0},
+    {{0x20, 0x01, 0x0d, 0xb8}, 32},
+    {{0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01}, 48},
+    {{0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02}, 64},
+    {{0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02}, 48},
+    {{0x20, 0x01, 0x0d, 0xb8, 0x80}, 33},
+    {{0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}, 64},
+};
+
+uint32_t UnitTester::sRandomSeed = 1;
+
+uint32_t UnitTester::GetNextRandom(void)
+{
+    // Simple LCG so that the generated scenarios are reproducible.
+
+    sRandomSeed = sRandomSeed * 1103515245 + 12345;
+
+    return sRandomSeed >> 16;
+}
+
+void UnitTester::GenerateNetworkData(NetworkData::Leader &aLeader)
+{
+    // Generates a random Network Data with a Prefix TLV for every
+    // entry in `kTestPrefixes`, each with randomly populated Has
+    // Route and Border Router sub-TLVs.
+
+    static const uint8_t  kPreferenceBits[] = {0x0, 0x1, 0x3}; // medium, high, low
+    static const uint16_t kRlocs[]          = {0x0400, 0x0800, 0x0c00, 0x0401, 0x0802, 0x1000};
+
+    static constexpr uint16_t kDefaultRouteFlag = 1 << 9;
+    static constexpr uint16_t kOnMeshFlag       = 1 << 8;
+
+    uint8_t *tlvs   = aLeader.GetBytes();
+    uint8_t  length = 0;
+
+    for (const TestPrefix &testPrefix : kTestPrefixes)
+    {
+        uint8_t prefixTlvStart = length;
+        uint8_t numEntries;
+
+        tlvs[length++] = NetworkData::NetworkDataTlv::kTypePrefix << 1;
+        length++; // Prefix TLV length, filled in below.
+        tlvs[length++] = static_cast<uint8_t>(GetNextRandom() % 2); // Domain ID
+        tlvs[length++] = testPrefix.mLength;
+        memcpy(&tlvs[length], testPrefix.mPrefix, BytesForBitSize(testPrefix.mLength));
+        length += BytesForBitSize(testPrefix.mLength);
+
+        numEntries = static_cast<uint8_t>(GetNextRandom() % 3);
+
+        if (numEntries > 0)
+        {
+            tlvs[length++] = NetworkData::NetworkDataTlv::kTypeHasRoute << 1;
+            tlvs[length++] = numEntries * 3;
+
+            for (uint8_t i = 0; i < numEntries; i++)
+            {
+                uint16_t rloc16 = kRlocs[GetNextRandom() % GetArrayLength(kRlocs)];
+
+                tlvs[length++] = static_cast<uint8_t>(rloc16 >> 8);
+                tlvs[length++] = static_cast<uint8_t>(rloc16 & 0xff);
+                tlvs[length++] = static_cast<uint8_t>(kPreferenceBits[GetNextRandom() % 3] << 6);
+            }
+        }
+
+        numEntries = static_cast<uint8_t>(GetNextRandom() % 3);
+
+        if (numEntries > 0)
+        {
+            tlvs[length++] = NetworkData::NetworkDataTlv::kTypeBorderRouter << 1;
+            tlvs[length++] = numEntries * 4;
+
+            for (uint8_t i = 0; i < numEntries; i++)
+            {
+                uint16_t rloc16 = kRlocs[GetNextRandom() % GetArrayLength(kRlocs)];
+                uint16_t flags  = static_cast<uint16_t>(kPreferenceBits[GetNextRandom() % 3] << 14);
+
+                flags |= (GetNextRandom() % 2) ? kDefaultRouteFlag : 0;
+                flags |= (GetNextRandom() % 2) ? kOnMeshFlag : 0;
+
+                tlvs[length++] = static_cast<uint8_t>(rloc16 >> 8);
+                tlvs[length++] = static_cast<uint8_t>(rloc16 & 0xff);
+                tlvs[length++] = static_cast<uint8_t>(flags >> 8);
+                tlvs[length++] = static_cast<uint8_t>(flags & 0xff);
+            }
+        }
+
+        tlvs[prefixTlvStart + 1] = length - prefixTlvStart - 2;
+    }
+
+    VerifyOrQuit(length <= NetworkData::NetworkData::kMaxSize);
+    aLeader.SetLength(length);
+    aLeader.UpdateRouteCache();
+}
+
+void UnitTester::GenerateAddress(Ip6::Address &aAddress)
+{
+    // Picks a random address which either matches one of the
+    // `kTestPrefixes` or is fully random.
+
+    uint32_t index = GetNextRandom() % (GetArrayLength(kTestPrefixes) + 1);
+
+    for (uint8_t i = 0; i < OT_IP6_ADDRESS_SIZE; i++)
+    {
+        aAddress.mFields.m8[i] = static_cast<uint8_t>(GetNextRandom());
+    }
+
+    if (index < GetArrayLength(kTestPrefixes))
+    {
+        aAddress.SetPrefix(kTestPrefixes[index].mPrefix, kTestPrefixes[index].mLength);
+    }
+}
+
+void UnitTester::TestNetworkDataRouteCache(void)
+{
+    static constexpr uint16_t kNumNetworkData = 200;
+    static constexpr uint16_t kNumLookups     = 200;
+
+    Instance            *instance;
+    NetworkData::Leader *leader;
+    uint32_t             numRoutes = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataRouteCache()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &instance->Get<NetworkData::Leader>();
+
+    for (uint16_t netDataIndex = 0; netDataIndex < kNumNetworkData; netDataIndex++)
+    {
+        GenerateNetworkData(*leader);
+        VerifyOrQuit(leader->mIsRouteCacheValid);
+
+        for (uint16_t lookup = 0; lookup < kNumLookups; lookup++)
+        {
+            Ip6::Address source;
+            Ip6::Address destination;
+            uint16_t     cacheRloc16  = Mle::kInvalidRloc16;
+            uint16_t     searchRloc16 = Mle::kInvalidRloc16;
+            Error        cacheError;
+            Error        searchError;
+            bool         cacheIsOnMesh;
+
+            GenerateAddress(source);
+            GenerateAddress(destination);
+
+            cacheError    = leader->RouteLookup(source, destination, cacheRloc16);
+            cacheIsOnMesh = leader->IsOnMesh(destination);
+
+            leader->mIsRouteCacheValid = false;
+
+            searchError = leader->RouteLookup(source, destination, searchRloc16);
+            VerifyOrQuit(leader->IsOnMesh(destination) == cacheIsOnMesh);
+
+            leader->mIsRouteCacheValid = true;
+
+            VerifyOrQuit(cacheError == searchError);
+            VerifyOrQuit(cacheRloc16 == searchRloc16);
+
+            numRoutes += (cacheError == kErrorNone) ? 1 : 0;
+        }
+    }
+
+    printf("\n%u lookups, %lu found a route", kNumNetworkData * kNumLookups, ToUlong(numRoutes));
+
+    // A Network Data with a duplicate prefix is not cached and the
+    // lookups fall back to searching the TLVs.
+
+    {
+        const uint8_t kNetworkData[] = {
+            0x02, 0x10, 0x00, 0x40, 0xfd, 0x00, 0x12, 0x34, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x54, 0x00, 0x02, 0x00,
+            0x02, 0x0f, 0x01, 0x40, 0xfd, 0x00, 0x12, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc8, 0x00, 0x40,
+        };
+
+        Ip6::Address source;
+        Ip6::Address destination;
+        uint16_t     rloc16;
+
+        memcpy(leader->GetBytes(), kNetworkData, sizeof(kNetworkData));
+        leader->SetLength(sizeof(kNetworkData));
+        leader->UpdateRouteCache();
+        VerifyOrQuit(!leader->mIsRouteCacheValid);
+
+        SuccessOrQuit(source.FromString("fd00:1234::1"));
+        SuccessOrQuit(destination.FromString("2001:db8::1"));
+        SuccessOrQuit(leader->RouteLookup(source, destination, rloc16));
+        VerifyOrQuit(rloc16 == 0x5400);
+        VerifyOrQuit(!leader->IsOnMesh(destination));
+
+        SuccessOrQuit(source.FromString("2001:db8::2"));
+        VerifyOrQuit(leader->RouteLookup(source, destination, rloc16) == kErrorNoRoute);
+    }
+
+    testFreeInstance(instance);
+}
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+void UnitTester::TestNetworkDataRouteCachePerformance(void)
+{
+    static constexpr uint16_t kNumNetworkData = 200;
+    static constexpr uint16_t kNumLookups     = 200;
+
+    Instance            *instance;
+    NetworkData::Leader *leader;
+    Ip6::Address         sources[kNumLookups];
+    Ip6::Address         destinations[kNumLookups];
+    uint64_t             cacheTime  = 0;
+    uint64_t             searchTime = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataRouteCachePerformance()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &instance->Get<NetworkData::Leader>();
+
+    for (uint16_t netDataIndex = 0; netDataIndex < kNumNetworkData; netDataIndex++)
+    {
+        uint16_t rloc16;
+        uint64_t startTime;
+
+        GenerateNetworkData(*leader);
+
+        for (uint16_t lookup = 0; lookup < kNumLookups; lookup++)
+        {
+            GenerateAddress(sources[lookup]);
+            GenerateAddress(destinations[lookup]);
+        }
+
+        startTime = GetWallClockUsec();
+
+        for (uint16_t lookup = 0; lookup < kNumLookups; lookup++)
+        {
+            IgnoreError(leader->RouteLookup(sources[lookup], destinations[lookup], rloc16));
+            IgnoreReturnValue(leader->IsOnMesh(destinations[lookup]));
+        }
+
+        cacheTime += GetWallClockUsec() - startTime;
+
+        leader->mIsRouteCacheValid = false;
+
+        startTime = GetWallClockUsec();
+
+        for (uint16_t lookup = 0; lookup < kNumLookups; lookup++)
+        {
+            IgnoreError(leader->RouteLookup(sources[lookup], destinations[lookup], rloc16));
+            IgnoreReturnValue(leader->IsOnMesh(destinations[lookup]));
+        }
+
+        searchTime += GetWallClockUsec() - startTime;
+    }
+
+    printf("\nRoute cache ------------- %.3f usec/lookup",
+           static_cast<double>(cacheTime) / (kNumNetworkData * kNumLookups));
+    printf("\nTLV search -------------- %.3f usec/lookup",
+           static_cast<double>(searchTime) / (kNumNetworkData * kNumLookups));
+
+    testFreeInstance(instance);
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
+#endif // OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+
 } // namespace ot
 
 int main(void)
@@ -1076,6 +1370,12 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_ENABLE
+    ot::UnitTester::TestNetworkDataRouteCache();
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    ot::UnitTester::TestNetworkDataRouteCachePerformance();
+#endif
+#endif
 
     printf("\nAll tests passed\n");
     return 0;
@@ -125,6 +125,58 @@ void TestKeyManagerKek(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+void TestKeyManagerKeyCache(void)
+{
+    static constexpr uint32_t kKeySequence = 100;
+
+    Instance   *instance   = testInitInstance();
+    KeyManager &keyManager = instance->Get<KeyManager>();
+    Mle::Key    prevKey;
+    Mle::Key    nextKey;
+    Mle::Key    key;
+
+    keyManager.SetCurrentKeySequence(kKeySequence, KeyManager::kForceUpdate);
+    keyManager.ResetKeyCacheCounters();
+
+    // Keys for the adjacent key sequences are served from the cache.
+
+    keyManager.GetTemporaryMleKey(kKeySequence - 1).ExtractKey(prevKey);
+    keyManager.GetTemporaryMleKey(kKeySequence + 1).ExtractKey(nextKey);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 2);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 0);
+
+    // Other key sequences are derived.
+
+    keyManager.GetTemporaryMleKey(kKeySequence + 2).ExtractKey(key);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 2);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 1);
+
+    // The cached keys must match the keys derived when the key
+    // sequence is switched.
+
+    keyManager.SetCurrentKeySequence(kKeySequence + 1, KeyManager::kForceUpdate);
+    keyManager.GetCurrentMleKey().ExtractKey(key);
+    VerifyOrQuit(key == nextKey);
+
+    keyManager.SetCurrentKeySequence(kKeySequence - 1, KeyManager::kForceUpdate);
+    keyManager.GetCurrentMleKey().ExtractKey(key);
+    VerifyOrQuit(key == prevKey);
+
+    // The cache is refreshed on key sequence change.
+
+    keyManager.GetTemporaryMleKey(kKeySequence).ExtractKey(key);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 3);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 1);
+
+    keyManager.ResetKeyCacheCounters();
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 0);
+    VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 0);
+
+    testFreeInstance(instance);
+}
+#endif
+
 } // namespace MeshCoP
 } // namespace ot
 
@@ -137,6 +189,9 @@ int main(void)
     ot::MeshCoP::TestMaximumPassphrase();
     ot::MeshCoP::TestExampleInSpec();
     ot::MeshCoP::TestKeyManagerKek();
+#if OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_ENABLE
+    ot::MeshCoP::TestKeyManagerKeyCache();
+#endif
     printf("All tests passed\n");
 #else
     printf("PSKc generation is not supported on non-ftd build\n");
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "lib/spinel/frame_ring.hpp"
+#include "lib/spinel/multi_frame_buffer.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Spinel {
+
+constexpr uint32_t kRingSize          = 256;   // Ring size (small to exercise wrap-around)
+constexpr uint16_t kHeaderSize        = 2;     // Per-frame length header size
+constexpr uint16_t kMaxFrameLength    = 120;   // Maximum frame length used in the fuzz test
+constexpr uint32_t kFuzzTestIteration = 20000; // Number of push/pop operations in the fuzz test
+
+static const uint8_t sOpenThreadText[] = "OpenThread Rocks";
+static const uint8_t sMottoText[]      = "Think good thoughts, say good words, do good deeds!";
+
+void TestFrameRing(void)
+{
+    FrameRing<kRingSize>   ring;
+    FrameBuffer<kRingSize> frameBuffer;
+    FrameBuffer<kRingSize> smallBuffer;
+    uint8_t                frame[kRingSize];
+    uint16_t               pushed;
+
+    printf("Testing FrameRing");
+
+    VerifyOrQuit(!ring.HasFrame());
+    VerifyOrQuit(ring.GetUsedSize() == 0);
+    VerifyOrQuit(ring.Pop(frameBuffer) == OT_ERROR_NOT_FOUND);
+
+    SuccessOrQuit(ring.Push(sOpenThreadText, sizeof(sOpenThreadText)));
+    SuccessOrQuit(ring.Push(sMottoText, sizeof(sMottoText)));
+    VerifyOrQuit(ring.HasFrame());
+    VerifyOrQuit(ring.GetUsedSize() == 2 * kHeaderSize + sizeof(sOpenThreadText) + sizeof(sMottoText));
+
+    SuccessOrQuit(ring.Pop(frameBuffer));
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sOpenThreadText));
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sOpenThreadText, sizeof(sOpenThreadText)) == 0);
+    frameBuffer.Clear();
+
+    SuccessOrQuit(ring.Pop(frameBuffer));
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sMottoText));
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sMottoText, sizeof(sMottoText)) == 0);
+    frameBuffer.Clear();
+
+    VerifyOrQuit(!ring.HasFrame());
+    VerifyOrQuit(ring.GetUsedSize() == 0);
+    printf(".");
+
+    // Fill the ring completely, a frame which does not fit must be
+    // rejected and leave the ring unchanged.
+
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+
+    pushed = static_cast<uint16_t>(kRingSize - ring.GetUsedSize() - kHeaderSize);
+    SuccessOrQuit(ring.Push(frame, pushed));
+    VerifyOrQuit(ring.GetUsedSize() == kRingSize);
+    VerifyOrQuit(ring.Push(frame, 0) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(ring.GetUsedSize() == kRingSize);
+
+    SuccessOrQuit(ring.Pop(frameBuffer));
+    VerifyOrQuit(frameBuffer.GetLength() == pushed);
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), frame, pushed) == 0);
+    frameBuffer.Clear();
+    VerifyOrQuit(ring.GetUsedSize() == 0);
+    printf(".");
+
+    // A frame which does not fit in the write pointer is still
+    // removed from the ring.
+
+    SuccessOrQuit(ring.Push(sMottoText, sizeof(sMottoText)));
+    SuccessOrQuit(ring.Push(sOpenThreadText, sizeof(sOpenThreadText)));
+    SuccessOrQuit(smallBuffer.WriteBytes(frame, kRingSize - sizeof(sMottoText) + 1));
+    VerifyOrQuit(ring.Pop(smallBuffer) == OT_ERROR_NO_BUFS);
+    SuccessOrQuit(ring.Pop(frameBuffer));
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sOpenThreadText));
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sOpenThreadText, sizeof(sOpenThreadText)) == 0);
+    frameBuffer.Clear();
+    VerifyOrQuit(!ring.HasFrame());
+
+    ring.Clear();
+    VerifyOrQuit(ring.GetUsedSize() == 0);
+
+    printf(" -- PASS\n");
+}
+
+void TestFuzzFrameRing(void)
+{
+    FrameRing<kRingSize>   ring;
+    FrameBuffer<kRingSize> frameBuffer;
+    uint8_t                pushSeq = 0;
+    uint8_t                popSeq  = 0;
+    uint16_t               pushLength;
+    uint16_t               popLength;
+    uint32_t               numFrames = 0;
+    uint32_t               wraps     = 0;
+
+    printf("Testing FrameRing with random frames");
+
+    srand(0);
+
+    // Each frame is filled with bytes derived from its sequence
+    // number and its length, so that popped frames can be checked
+    // without tracking their content.
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration; iter++)
+    {
+        if ((rand() % 2) == 0)
+        {
+            uint8_t frame[kMaxFrameLength];
+
+            pushLength = static_cast<uint16_t>(static_cast<uint8_t>(pushSeq * 7) % kMaxFrameLength);
+
+            for (uint16_t i = 0; i < pushLength; i++)
+            {
+                frame[i] = static_cast<uint8_t>(pushSeq + i);
+            }
+
+            if (ring.Push(frame, pushLength) == OT_ERROR_NONE)
+            {
+                pushSeq++;
+                numFrames++;
+            }
+            else
+            {
+                VerifyOrQuit(kRingSize - ring.GetUsedSize() < static_cast<uint32_t>(kHeaderSize + pushLength));
+            }
+        }
+        else if (numFrames == 0)
+        {
+            VerifyOrQuit(ring.Pop(frameBuffer) == OT_ERROR_NOT_FOUND);
+        }
+        else
+        {
+            SuccessOrQuit(ring.Pop(frameBuffer));
+
+            popLength = static_cast<uint16_t>(static_cast<uint8_t>(popSeq * 7) % kMaxFrameLength);
+            VerifyOrQuit(frameBuffer.GetLength() == popLength);
+
+            for (uint16_t i = 0; i < popLength; i++)
+            {
+                VerifyOrQuit(frameBuffer.GetFrame()[i] == static_cast<uint8_t>(popSeq + i));
+            }
+
+            frameBuffer.Clear();
+            popSeq++;
+            numFrames--;
+
+            if (popSeq == 0)
+            {
+                wraps++;
+            }
+        }
+
+        VerifyOrQuit(ring.HasFrame() == (numFrames != 0));
+        VerifyOrQuit(ring.GetUsedSize() <= kRingSize);
+    }
+
+    VerifyOrQuit(wraps > 0);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace Spinel
+} // namespace ot
+
+int main(void)
+{
+    ot::Spinel::TestFrameRing();
+    ot::Spinel::TestFuzzFrameRing();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -107,7 +107,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 8000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 void *otPlatCAlloc(size_t aNum, size_t aSize)
@@ -1494,6 +1494,418 @@ void TestSrpServerAddressModeForceAdd(void)
     Log("End of TestSrpServerAddressModeForceAdd");
 }
 
+static Message *sCapturedUpdateMsg;
+static uint16_t sRelayRxCount;
+static bool     sRelayRxAllSuccess;
+
+void HandleCaptureUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    Message &message = AsCoreType(aMessage);
+
+    VerifyOrQuit(aContext == nullptr);
+    VerifyOrQuit(aMessageInfo != nullptr);
+
+    Log("HandleCaptureUdpReceive(), message-len:%u", message.GetLength() - message.GetOffset());
+
+    if (sCapturedUpdateMsg == nullptr)
+    {
+        sCapturedUpdateMsg = message.Clone<kNoReservedHeader>();
+        VerifyOrQuit(sCapturedUpdateMsg != nullptr);
+    }
+}
+
+void HandleRelayUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    Dns::UpdateHeader header;
+
+    VerifyOrQuit(aContext == nullptr);
+    VerifyOrQuit(aMessageInfo != nullptr);
+
+    SuccessOrQuit(AsCoreType(aMessage).Read(AsCoreType(aMessage).GetOffset(), header));
+    VerifyOrQuit(header.GetType() == Dns::UpdateHeader::kTypeResponse);
+
+    Log("HandleRelayUdpReceive(), message-id:0x%x, response-code:%u", header.GetMessageId(),
+        header.GetResponseCode());
+
+    if (header.GetResponseCode() != Dns::UpdateHeader::kResponseSuccess)
+    {
+        sRelayRxAllSuccess = false;
+    }
+
+    sRelayRxCount++;
+}
+
+void SendCapturedUpdate(Ip6::Udp::Socket &aSocket, uint16_t aServerPort)
+{
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+
+    message = aSocket.NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(message->AppendBytesFromMessage(*sCapturedUpdateMsg, sCapturedUpdateMsg->GetOffset(),
+                                                  sCapturedUpdateMsg->GetLength() - sCapturedUpdateMsg->GetOffset()));
+
+    messageInfo.SetPeerAddr(sInstance->Get<Mle::Mle>().GetMeshLocalRloc());
+    messageInfo.SetPeerPort(aServerPort);
+
+    SuccessOrQuit(aSocket.SendTo(*message, messageInfo));
+}
+
+void TestSrpServerUpdateRetransmission(void)
+{
+    static constexpr uint16_t kCapturePort = 12345;
+    static constexpr uint16_t kRelayPort   = 12346;
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    static constexpr uint16_t kNumQueueFullPorts = OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH + 2;
+#endif
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Srp::Client::Service     service1;
+    const Srp::Server::Host *host;
+    Ip6::SockAddr            captureSockAddr;
+    uint16_t                 heapAllocations;
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    uint32_t numSuccess;
+#endif
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerUpdateRetransmission");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(nullptr, nullptr);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client using a socket which captures the SRP update
+    // message sent by the client.
+
+    Ip6::Udp::Socket captureSocket(*sInstance, HandleCaptureUdpReceive, nullptr);
+    Ip6::Udp::Socket relaySocket(*sInstance, HandleRelayUdpReceive, nullptr);
+
+    sCapturedUpdateMsg = nullptr;
+
+    SuccessOrQuit(captureSocket.Open(Ip6::kNetifThreadInternal));
+    SuccessOrQuit(captureSocket.Bind(kCapturePort));
+
+    captureSockAddr.SetAddress(sInstance->Get<Mle::Mle>().GetMeshLocalRloc());
+    captureSockAddr.SetPort(kCapturePort);
+
+    srpClient->DisableAutoStartMode();
+    srpClient->Stop();
+    SuccessOrQuit(srpClient->Start(captureSockAddr));
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    PrepareService1(service1);
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    AdvanceTime(15 * 1000);
+    VerifyOrQuit(sCapturedUpdateMsg != nullptr);
+
+    srpClient->Stop();
+    SuccessOrQuit(captureSocket.Close());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the captured SRP update message twice back-to-back to the
+    // server and validate that it is accepted and the host and its
+    // service are registered.
+
+    Log("Send captured SRP update message twice");
+
+    SuccessOrQuit(relaySocket.Open(Ip6::kNetifThreadInternal));
+    SuccessOrQuit(relaySocket.Bind(kRelayPort));
+
+    sRelayRxCount      = 0;
+    sRelayRxAllSuccess = true;
+
+    SendCapturedUpdate(relaySocket, srpServer->GetPort());
+    SendCapturedUpdate(relaySocket, srpServer->GetPort());
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sRelayRxCount >= 1);
+    VerifyOrQuit(sRelayRxAllSuccess);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(StringMatch(host->GetFullName(), "myhost.default.service.arpa.", kStringCaseInsensitiveMatch));
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(host->GetNextService(nullptr) != nullptr);
+    VerifyOrQuit(srpServer->GetNextHost(host) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the captured SRP update message again (as if the response
+    // from server was lost and client retransmitted) and validate
+    // that it is accepted again.
+
+    Log("Retransmit captured SRP update message");
+
+    sRelayRxCount = 0;
+
+    SendCapturedUpdate(relaySocket, srpServer->GetPort());
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sRelayRxCount == 1);
+    VerifyOrQuit(sRelayRxAllSuccess);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(srpServer->GetNextHost(host) == nullptr);
+
+    SuccessOrQuit(relaySocket.Close());
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_ENABLE
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the captured SRP update message back-to-back from more
+    // source ports than the update queue can hold, so that they are
+    // not dropped as retransmissions of a queued update. Validate
+    // that the updates which do not fit in the queue are dropped
+    // instead of being processed ahead of the queued ones.
+
+    Log("Send captured SRP update message from more ports than the queue length");
+
+    numSuccess = srpServer->GetResponseCounters()->mSuccess;
+
+    for (uint16_t index = 0; index < kNumQueueFullPorts; index++)
+    {
+        SuccessOrQuit(relaySocket.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(relaySocket.Bind(kRelayPort + 1 + index));
+        SendCapturedUpdate(relaySocket, srpServer->GetPort());
+        SuccessOrQuit(relaySocket.Close());
+    }
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(srpServer->GetResponseCounters()->mSuccess - numSuccess ==
+                 OPENTHREAD_CONFIG_SRP_SERVER_UPDATE_QUEUE_MAX_LENGTH);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(srpServer->GetNextHost(host) == nullptr);
+#endif
+
+    sCapturedUpdateMsg->Free();
+    sCapturedUpdateMsg = nullptr;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerUpdateRetransmission");
+}
+
+void TestSrpServerManyHosts(void)
+{
+    // The number of hosts is limited by the heap size when using
+    // the internal heap.
+    static constexpr uint16_t kNumHosts    = OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE ? 1000 : 50;
+    static constexpr uint16_t kNumTypes    = 4;
+    static constexpr uint16_t kNameBufSize = 32;
+
+    static const char *const kServiceTypes[kNumTypes] = {"_srv._udp", "_tst._tcp", "_abc._udp", "_xyz._tcp"};
+
+    Srp::Server             *srpServer;
+    Srp::Client             *srpClient;
+    Srp::Client::Service     service;
+    const Srp::Server::Host *host;
+    char                     hostName[kNameBufSize];
+    char                     instanceLabel[kNameBufSize];
+    uint16_t                 heapAllocations;
+    uint16_t                 numHosts;
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    uint64_t startTime;
+    uint64_t duration;
+#endif
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerManyHosts");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(nullptr, nullptr);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register `kNumHosts` hosts, each with one service. After each
+    // registration, the client host info is cleared (without
+    // removing it on server) so the next one registers a new host
+    // (using the same key).
+
+    Log("Register %u hosts", kNumHosts);
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    startTime = GetWallClockUsec();
+#endif
+
+    for (uint16_t index = 0; index < kNumHosts; index++)
+    {
+        srpClient->ClearHostAndServices();
+
+        snprintf(hostName, sizeof(hostName), "host%u", index);
+        snprintf(instanceLabel, sizeof(instanceLabel), "inst%u", index);
+
+        SuccessOrQuit(srpClient->SetHostName(hostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+        ClearAllBytes(service);
+        service.mName         = kServiceTypes[index % kNumTypes];
+        service.mInstanceName = instanceLabel;
+        service.mPort         = 1234;
+
+        SuccessOrQuit(srpClient->AddService(service));
+
+        sProcessedClientCallback = false;
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+    }
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    duration = GetWallClockUsec() - startTime;
+
+    printf("\nTestSrpServerManyHosts\n");
+    printf("  hosts: %u, total: %lu usec, per update: %lu usec\n", kNumHosts,
+           ToUlong(static_cast<uint32_t>(duration)), ToUlong(static_cast<uint32_t>(duration / kNumHosts)));
+#endif
+
+    numHosts = 0;
+
+    for (host = srpServer->GetNextHost(nullptr); host != nullptr; host = srpServer->GetNextHost(host))
+    {
+        const Srp::Server::Service *srpService = host->GetNextService(nullptr);
+
+        VerifyOrQuit(srpService != nullptr);
+        VerifyOrQuit(host->GetNextService(srpService) == nullptr);
+        VerifyOrQuit(!srpService->IsDeleted());
+        numHosts++;
+    }
+
+    VerifyOrQuit(numHosts == kNumHosts);
+
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the client key so that a new one is generated. Validate
+    // that registering an existing service instance name (of the
+    // first host) with a new key is rejected as a name conflict.
+
+    Log("Register a new host with a conflicting service instance name");
+
+    srpClient->ClearHostAndServices();
+    sInstance->Get<Settings>().Delete<Settings::SrpEcdsaKey>();
+
+    SuccessOrQuit(srpClient->SetHostName("newhost"));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    ClearAllBytes(service);
+    service.mName         = kServiceTypes[0];
+    service.mInstanceName = "inst0";
+    service.mPort         = 1234;
+
+    SuccessOrQuit(srpClient->AddService(service));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorDuplicated);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that registering an existing host name (with a new
+    // service instance name) using the new key is also rejected.
+
+    Log("Register an existing host name with a new key");
+
+    srpClient->ClearHostAndServices();
+
+    snprintf(hostName, sizeof(hostName), "host%u", kNumHosts - 1);
+    SuccessOrQuit(srpClient->SetHostName(hostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    ClearAllBytes(service);
+    service.mName         = kServiceTypes[0];
+    service.mInstanceName = "newinst";
+    service.mPort         = 1234;
+
+    SuccessOrQuit(srpClient->AddService(service));
+
+    sProcessedClientCallback = false;
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorDuplicated);
+#endif
+
+    srpClient->ClearHostAndServices();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerManyHosts");
+}
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
 
 void TestSrpServerFastStartMode(void)
@@ -1628,6 +2040,8 @@ int main(void)
     ot::TestSrpClientSingleServiceMode();
 #endif
     ot::TestSrpServerAddressModeForceAdd();
+    ot::TestSrpServerUpdateRetransmission();
+    ot::TestSrpServerManyHosts();
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     ot::TestSrpServerFastStartMode();
 #endif
@@ -27,6 +27,7 @@
  */
 
 #include "test_platform.h"
+#include "test_util.hpp"
 
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
@@ -107,16 +108,20 @@ public:
     {
         sCallCount[kCallCountIndexTimerHandler]++;
         mFiredCounter++;
+        mFiredTime = sNow;
     }
 
     uint32_t GetFiredCounter(void) { return mFiredCounter; }
 
+    uint32_t GetFiredTime(void) { return mFiredTime; }
+
     void ResetFiredCounter(void) { mFiredCounter = 0; }
 
     static void RemoveAll(Instance &aInstance) { TimerType::RemoveAll(aInstance); }
 
 private:
     uint32_t mFiredCounter; //< Number of times timer has been fired so far
+    uint32_t mFiredTime;    //< The `sNow` time when timer was last fired
 };
 
 template <typename TimerType> void AlarmFired(otInstance *aInstance);
@@ -578,6 +583,174 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+static uint32_t GetNextRandom(uint32_t &aSeed)
+{
+    aSeed = aSeed * 1664525U + 1013904223U;
+    return aSeed >> 8;
+}
+
+/**
+ * Starts, stops and restarts the given timers in random order, leaving all of them running.
+ */
+template <typename TimerType>
+void StartTimersRandomly(TestTimer<TimerType> **aTimers, uint16_t aNumTimers, uint32_t &aSeed)
+{
+    const uint32_t kMaxInterval  = 100000;
+    const uint16_t kNumRestarts  = 4;
+    const uint16_t kStopInterval = 3;
+
+    for (uint16_t restart = 0; restart < kNumRestarts; restart++)
+    {
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            TestTimer<TimerType> &timer = *aTimers[GetNextRandom(aSeed) % aNumTimers];
+
+            if ((i % kStopInterval) == 0)
+            {
+                timer.Stop();
+            }
+            else
+            {
+                timer.Start(GetNextRandom(aSeed) % kMaxInterval);
+            }
+        }
+
+        sNow++;
+    }
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        if (!aTimers[i]->IsRunning())
+        {
+            aTimers[i]->Start(GetNextRandom(aSeed) % kMaxInterval);
+        }
+    }
+}
+
+/**
+ * Advances `sNow` to each alarm fire time until no timer is running.
+ */
+template <typename TimerType> void FireAllTimers(Instance *aInstance)
+{
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        AlarmFired<TimerType>(aInstance);
+    }
+}
+
+/**
+ * Test the TimerScheduler with many timers which are started, stopped and restarted in random order, verifying that
+ * every timer fires exactly at its fire time.
+ */
+template <typename TimerType> void ManyTimers(uint16_t aNumTimers)
+{
+    const uint32_t kTimeT0 = 1000;
+
+    Instance              *instance = testInitInstance();
+    TestTimer<TimerType> **timers   = new TestTimer<TimerType> *[aNumTimers];
+    uint32_t               seed     = aNumTimers;
+
+    printf("TestManyTimers() with %4u timers ", aNumTimers);
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        timers[i] = new TestTimer<TimerType>(*instance);
+    }
+
+    sNow = kTimeT0;
+
+    StartTimersRandomly<TimerType>(timers, aNumTimers, seed);
+
+    VerifyOrQuit(sTimerOn);
+
+    FireAllTimers<TimerType>(instance);
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == aNumTimers);
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i]->IsRunning());
+        VerifyOrQuit(timers[i]->GetFiredCounter() == 1);
+        VerifyOrQuit(timers[i]->GetFiredTime() == timers[i]->GetFireTime().GetValue());
+
+        delete timers[i];
+    }
+
+    delete[] timers;
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint16_t kNumTimers[] = {10, 100, 1000};
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        ManyTimers<TimerType>(numTimers);
+    }
+
+    return 0;
+}
+
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+
+/**
+ * Reports the wall-clock time spent in the TimerScheduler starting and firing many timers.
+ */
+template <typename TimerType> void TestTimerSchedulerPerformance(void)
+{
+    const uint32_t kTimeT0      = 1000;
+    const uint16_t kNumTimers[] = {100, 1000, 5000};
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        Instance              *instance = testInitInstance();
+        TestTimer<TimerType> **timers   = new TestTimer<TimerType> *[numTimers];
+        uint32_t               seed     = numTimers;
+        uint64_t               startUsec;
+        uint64_t               fireUsec;
+
+        TestTimer<TimerType>::RemoveAll(*instance);
+        InitCounters();
+
+        for (uint16_t i = 0; i < numTimers; i++)
+        {
+            timers[i] = new TestTimer<TimerType>(*instance);
+        }
+
+        sNow = kTimeT0;
+
+        startUsec = GetWallClockUsec();
+        StartTimersRandomly<TimerType>(timers, numTimers, seed);
+        startUsec = GetWallClockUsec() - startUsec;
+
+        fireUsec = GetWallClockUsec();
+        FireAllTimers<TimerType>(instance);
+        fireUsec = GetWallClockUsec() - fireUsec;
+
+        for (uint16_t i = 0; i < numTimers; i++)
+        {
+            delete timers[i];
+        }
+
+        delete[] timers;
+
+        printf("TestTimerSchedulerPerformance() with %5u timers (start: %7lu usec, fire: %7lu usec)\n", numTimers,
+               static_cast<unsigned long>(startUsec), static_cast<unsigned long>(fireUsec));
+
+        testFreeInstance(instance);
+    }
+}
+
+#endif // OT_UNIT_TEST_BENCHMARK_ENABLE
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -676,6 +849,10 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
+#if OT_UNIT_TEST_BENCHMARK_ENABLE
+    TestTimerSchedulerPerformance<TimerType>();
+#endif
 }
 
 } // namespace ot
@@ -29,6 +29,7 @@
 #include "test_util.hpp"
 
 #include <ctype.h>
+#include <sys/time.h>
 
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength)
 {
@@ -66,3 +67,12 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+uint64_t GetWallClockUsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, nullptr);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
@@ -34,6 +34,17 @@
 
 #include "common/arg_macros.hpp"
 
+/**
+ * @def OT_UNIT_TEST_BENCHMARK_ENABLE
+ *
+ * Set to 1 to include the wall-clock benchmarks in the unit tests (`OT_UNIT_TEST_BENCHMARK` CMake option).
+ *
+ * The benchmarks only report timing and are not part of the pass/fail checks.
+ */
+#ifndef OT_UNIT_TEST_BENCHMARK_ENABLE
+#define OT_UNIT_TEST_BENCHMARK_ENABLE 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
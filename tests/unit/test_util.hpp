@@ -42,4 +42,11 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * Returns the current wall-clock time in microseconds (e.g., to measure the duration of an operation).
+ *
+ * @returns The wall-clock time in microseconds.
+ */
+uint64_t GetWallClockUsec(void);
+
 #endif // OT_UNIT_TEST_UTIL_HPP_